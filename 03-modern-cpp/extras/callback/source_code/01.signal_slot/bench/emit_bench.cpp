@@ -0,0 +1,160 @@
+// Emit cost per slot: singal_emit (C, void *ctx, lock-free RCU snapshot)
+// against sigslot::Signal (InplaceFunction slots, one indirect call
+// each) and sigslot::FixedSignal (slots known by type, inlined). Every
+// slot increments its own counter; a compiler barrier after each emit
+// keeps the counters in memory so the inlined version still does the
+// increments. The counters are checked against the emit count, after a
+// quick check that slots returning a value connect and get called.
+//
+//   gcc -std=c11 -O2 -pthread -Iinclude -c bench/emit_bench_c.c src/signal.c ../common/src/rcu.c
+//   g++ -std=c++17 -O2 -pthread -Iinclude bench/emit_bench.cpp emit_bench_c.o signal.o rcu.o -o emit_bench
+//   ./emit_bench
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <utility>
+#include <vector>
+#include "Signal.hpp"
+
+extern "C" {
+void c_signal_setup(long *counters, std::size_t n);
+void c_signal_run(std::size_t reps);
+void c_signal_teardown(void);
+}
+
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+inline void barrier()
+{
+	__asm__ __volatile__("" ::: "memory");
+}
+
+// Best of three, in ns per slot call
+template <typename Run>
+double timePerSlot(std::size_t reps, std::size_t slots, Run run)
+{
+	double best = 1e30;
+	for (int r = 0; r < 3; ++r)
+	{
+		auto t0 = Clock::now();
+		run(reps);
+		double s = std::chrono::duration<double>(Clock::now() - t0).count();
+		best = std::min(best, s * 1e9 / double(reps * slots));
+	}
+	return best;
+}
+
+bool countersAre(const std::vector<long> &c, long expect)
+{
+	for (long v : c)
+		if (v != expect)
+			return false;
+	return true;
+}
+
+struct Bump
+{
+	long *counter;
+	void operator()() const { ++*counter; }
+};
+
+template <std::size_t... I>
+auto makeFixed(long *counters, std::index_sequence<I...>)
+{
+	return sigslot::makeFixedSignal<>(Bump{counters + I}...);
+}
+
+template <std::size_t N>
+double timeFixed(std::size_t reps, long *counters)
+{
+	auto fixed = makeFixed(counters, std::make_index_sequence<N>{});
+	return timePerSlot(reps, N, [&](std::size_t n) {
+		for (std::size_t r = 0; r < n; ++r)
+		{
+			fixed.emit();
+			barrier();
+		}
+	});
+}
+
+// FixedSignal needs the slot count at compile time; 0 if not one of these
+double fixedPerSlot(std::size_t slots, std::size_t reps, long *counters)
+{
+	switch (slots)
+	{
+	case 1: return timeFixed<1>(reps, counters);
+	case 4: return timeFixed<4>(reps, counters);
+	case 16: return timeFixed<16>(reps, counters);
+	case 64: return timeFixed<64>(reps, counters);
+	}
+	return 0;
+}
+
+void run(std::size_t slots, std::size_t reps)
+{
+	std::vector<long> counters(slots);
+	bool ok = true;
+
+	c_signal_setup(counters.data(), slots);
+	double c_ns = timePerSlot(reps, slots, c_signal_run);
+	c_signal_teardown();
+	ok &= countersAre(counters, 3 * long(reps));
+
+	counters.assign(slots, 0);
+	sigslot::Signal<> sig(slots);
+	for (std::size_t i = 0; i < slots; ++i)
+		sig.connect(Bump{&counters[i]});
+	double dyn_ns = timePerSlot(reps, slots, [&](std::size_t n) {
+		for (std::size_t r = 0; r < n; ++r)
+		{
+			sig.emit();
+			barrier();
+		}
+	});
+	ok &= countersAre(counters, 3 * long(reps));
+
+	counters.assign(slots, 0);
+	double fixed_ns = fixedPerSlot(slots, reps, counters.data());
+	if (fixed_ns)
+		ok &= countersAre(counters, 3 * long(reps));
+
+	char fixed[16] = "-";
+	if (fixed_ns)
+		std::snprintf(fixed, sizeof fixed, "%.2f", fixed_ns);
+	std::printf("%6zu %12.2f %12.2f %12s   %s\n", slots, c_ns, dyn_ns, fixed, ok ? "ok" : "WRONG COUNT");
+}
+
+int twice(int x)
+{
+	return 2 * x;
+}
+
+// Slots that return a value connect too; the value is dropped
+bool valueSlotsOk()
+{
+	int sum = 0;
+	sigslot::Signal<int> sig;
+	sig.connect([&sum](int x) { return sum += x; });
+	sig.connect(twice);
+	sig.connect(&twice);
+	sig.emit(3);
+	return sum == 3;
+}
+
+} // namespace
+
+int main()
+{
+	if (!valueSlotsOk())
+	{
+		std::printf("value-returning slots: WRONG RESULT\n");
+		return 1;
+	}
+	std::printf("ns per slot call\n\n%6s %12s %12s %12s\n", "slots", "singal_emit", "Signal", "FixedSignal");
+	for (std::size_t slots : {1, 4, 16, 64, 256})
+		run(slots, (std::size_t(1) << 24) / slots);
+}
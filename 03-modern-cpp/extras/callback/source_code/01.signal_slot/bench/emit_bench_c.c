@@ -0,0 +1,28 @@
+// C side of emit_bench.cpp: signal.h is C11 (<stdatomic.h>) and cannot be
+// included from C++, so the singal_t lives here.
+
+#include "signal.h"
+
+static singal_t sig;
+
+static void bump(void *ctx) {
+	++*(long *)ctx;
+}
+
+void c_signal_setup(long *counters, size_t n) {
+	signal_init(&sig);
+	for(size_t i = 0; i < n; i++) {
+		singal_connect(&sig, bump, &counters[i]);
+	}
+}
+
+void c_signal_run(size_t reps) {
+	for(size_t r = 0; r < reps; r++) {
+		singal_emit(&sig);
+		__asm__ __volatile__("" ::: "memory");
+	}
+}
+
+void c_signal_teardown(void) {
+	signal_destroy(&sig);
+}
@@ -0,0 +1,210 @@
+// Emit throughput while other threads keep connecting and disconnecting,
+// for the RCU signal against the same growable list behind a
+// pthread_rwlock (emit takes it shared, connect/disconnect exclusive).
+// Every emit must call each permanent slot exactly once; the totals are
+// checked at the end.
+//
+//   gcc -std=c11 -O2 -pthread -Iinclude bench/stress_bench.c src/signal.c ../common/src/rcu.c -o stress_bench
+//   ./stress_bench [emitters] [churners] [slots] [seconds]
+
+#define _POSIX_C_SOURCE 200809L
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "signal.h"
+
+// rwlock baseline
+typedef struct {
+	pthread_rwlock_t lock;
+	slot_t *slots;
+	size_t count;
+	size_t capacity;
+} locked_signal_t;
+
+static void locked_init(locked_signal_t *s) {
+	pthread_rwlock_init(&s->lock, NULL);
+	s->slots = NULL;
+	s->count = s->capacity = 0;
+}
+
+static void locked_destroy(locked_signal_t *s) {
+	free(s->slots);
+	pthread_rwlock_destroy(&s->lock);
+}
+
+static int locked_connect(locked_signal_t *s, slot_func_t slot, void *ctx) {
+	pthread_rwlock_wrlock(&s->lock);
+	if(s->count == s->capacity) {
+		size_t cap = s->capacity ? 2 * s->capacity : 4;
+		slot_t *p = realloc(s->slots, cap * sizeof(*p));
+		if(!p) {
+			pthread_rwlock_unlock(&s->lock);
+			return -1;
+		}
+		s->slots = p;
+		s->capacity = cap;
+	}
+	s->slots[s->count].slot = slot;
+	s->slots[s->count].ctx = ctx;
+	s->count++;
+	pthread_rwlock_unlock(&s->lock);
+	return 0;
+}
+
+static void locked_emit(locked_signal_t *s) {
+	pthread_rwlock_rdlock(&s->lock);
+	for(size_t i = 0; i < s->count; i++) {
+		s->slots[i].slot(s->slots[i].ctx);
+	}
+	pthread_rwlock_unlock(&s->lock);
+}
+
+static int locked_disconnect(locked_signal_t *s, slot_func_t slot) {
+	pthread_rwlock_wrlock(&s->lock);
+	for(size_t i = 0; i < s->count; i++) {
+		if(s->slots[i].slot == slot) {
+			memmove(&s->slots[i], &s->slots[i + 1], (s->count - i - 1) * sizeof(s->slots[0]));
+			s->count--;
+			pthread_rwlock_unlock(&s->lock);
+			return 0;
+		}
+	}
+	pthread_rwlock_unlock(&s->lock);
+	return -1;
+}
+
+// A slot's ctx is its own hit counter. Emitters run concurrently, hence
+// the atomic increment; it is the same cost on both sides.
+static void count_hit(void *ctx) {
+	atomic_fetch_add_explicit((atomic_size_t *)ctx, 1, memory_order_relaxed);
+}
+
+// What churners connect and disconnect; distinct from count_hit so the
+// disconnect never removes a permanent slot
+static void churn_slot(void *ctx) {
+	atomic_fetch_add_explicit((atomic_size_t *)ctx, 1, memory_order_relaxed);
+}
+
+typedef struct {
+	int              rcu;	// which implementation
+	singal_t         sig;
+	locked_signal_t  locked;
+	atomic_bool      stop;
+	atomic_size_t    churn_hits;
+} shared_t;
+
+typedef struct {
+	shared_t *sh;
+	size_t    ops;
+} worker_t;
+
+static void *emitter_main(void *arg) {
+	worker_t *w = arg;
+	shared_t *sh = w->sh;
+
+	while(!atomic_load_explicit(&sh->stop, memory_order_relaxed)) {
+		if(sh->rcu) {
+			singal_emit(&sh->sig);
+		} else {
+			locked_emit(&sh->locked);
+		}
+		w->ops++;
+	}
+	return NULL;
+}
+
+static void *churner_main(void *arg) {
+	worker_t *w = arg;
+	shared_t *sh = w->sh;
+
+	while(!atomic_load_explicit(&sh->stop, memory_order_relaxed)) {
+		if(sh->rcu) {
+			singal_connect(&sh->sig, churn_slot, &sh->churn_hits);
+			singal_disconnect(&sh->sig, churn_slot);
+		} else {
+			locked_connect(&sh->locked, churn_slot, &sh->churn_hits);
+			locked_disconnect(&sh->locked, churn_slot);
+		}
+		w->ops += 2;
+	}
+	return NULL;
+}
+
+static void sleep_seconds(double s) {
+	struct timespec ts = { (time_t)s, (long)((s - (time_t)s) * 1e9) };
+	nanosleep(&ts, NULL);
+}
+
+static int run(int rcu, size_t n_emit, size_t n_churn, size_t n_slots, double secs) {
+	static shared_t sh;
+	atomic_size_t *hits = calloc(n_slots, sizeof(*hits));
+	worker_t *w = calloc(n_emit + n_churn, sizeof(*w));
+	pthread_t *t = calloc(n_emit + n_churn, sizeof(*t));
+
+	sh.rcu = rcu;
+	signal_init(&sh.sig);
+	locked_init(&sh.locked);
+	atomic_store(&sh.stop, 0);
+	atomic_store(&sh.churn_hits, 0);
+	for(size_t i = 0; i < n_slots; i++) {
+		atomic_init(&hits[i], 0);
+		if(rcu) {
+			singal_connect(&sh.sig, count_hit, &hits[i]);
+		} else {
+			locked_connect(&sh.locked, count_hit, &hits[i]);
+		}
+	}
+
+	for(size_t i = 0; i < n_emit + n_churn; i++) {
+		w[i].sh = &sh;
+		pthread_create(&t[i], NULL, i < n_emit ? emitter_main : churner_main, &w[i]);
+	}
+	sleep_seconds(secs);
+	atomic_store(&sh.stop, 1);
+
+	size_t emits = 0, churns = 0;
+	for(size_t i = 0; i < n_emit + n_churn; i++) {
+		pthread_join(t[i], NULL);
+		if(i < n_emit) {
+			emits += w[i].ops;
+		} else {
+			churns += w[i].ops;
+		}
+	}
+
+	int ok = 1;
+	for(size_t i = 0; i < n_slots; i++) {
+		ok &= atomic_load(&hits[i]) == emits;
+	}
+
+	// slot calls per second over all emitters, as wall-clock ns per call
+	printf("%-7s %12.0f emits/s  %8.1f ns/slot call  %10.0f connect+disconnect/s  %s\n",
+	       rcu ? "rcu" : "rwlock", emits / secs,
+	       emits ? secs * 1e9 / ((double)emits * n_slots) : 0.0,
+	       churns / 2 / secs, ok ? "ok" : "MISSED CALLS");
+
+	signal_destroy(&sh.sig);
+	locked_destroy(&sh.locked);
+	free(t);
+	free(w);
+	free(hits);
+	return ok;
+}
+
+int main(int argc, char **argv) {
+	size_t n_emit  = argc > 1 ? strtoul(argv[1], NULL, 10) : 4;
+	size_t n_churn = argc > 2 ? strtoul(argv[2], NULL, 10) : 1;
+	size_t n_slots = argc > 3 ? strtoul(argv[3], NULL, 10) : 16;
+	double secs    = argc > 4 ? atof(argv[4]) : 1.0;
+
+	printf("%zu emitters, %zu connect/disconnect threads, %zu permanent slots, %.1f s each\n\n",
+	       n_emit, n_churn, n_slots, secs);
+
+	int ok = run(0, n_emit, n_churn, n_slots, secs);
+	ok &= run(1, n_emit, n_churn, n_slots, secs);
+	ok &= run(0, n_emit, 0, n_slots, secs);
+	ok &= run(1, n_emit, 0, n_slots, secs);
+	return ok ? 0 : 1;
+}
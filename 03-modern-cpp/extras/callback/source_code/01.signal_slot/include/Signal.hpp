@@ -0,0 +1,234 @@
+/**
+ * Signal.hpp
+ *
+ *  The signal/slot idea of signal.h, typed: a Signal<Args...> calls its
+ *  slots with Args... instead of handing each one a void *ctx to cast
+ *  back. Two flavours:
+ *
+ *  - FixedSignal: the slots are fixed when it is built and kept by type
+ *    in a tuple, so emit is a sequence of direct calls the compiler can
+ *    inline. makeFixedSignal<int>(slotA, slotB) builds one.
+ *  - Signal: connect/disconnect at run time. Each slot is an
+ *    InplaceFunction, a callable stored in a small buffer inside the
+ *    slot itself; one too large for it does not compile rather than
+ *    going to the heap.
+ *
+ *  Neither is thread-safe, and a slot must not connect to or disconnect
+ *  from the Signal that is calling it. For that, use signal.h.
+ */
+#ifndef SIGNAL_HPP_
+#define SIGNAL_HPP_
+
+#include <cassert>
+#include <cstddef>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace sigslot
+{
+
+// A plain function as an empty callable type, so that FixedSignal knows
+// which function it calls at compile time: FnSlot<&on_event>{}
+template <auto Fn>
+struct FnSlot
+{
+	template <typename... A>
+	void operator()(A &&...a) const
+	{
+		Fn(std::forward<A>(a)...);
+	}
+};
+
+template <typename Signature, std::size_t Capacity = 3 * sizeof(void *)>
+class InplaceFunction;
+
+// Move-only type-erased callable that never allocates: the callable is
+// constructed in buf_, and a call is one indirect call through invoke_
+template <typename R, typename... Args, std::size_t Capacity>
+class InplaceFunction<R(Args...), Capacity>
+{
+public:
+	InplaceFunction() noexcept = default;
+
+	template <typename F, typename Fn = std::decay_t<F>,
+	          typename = std::enable_if_t<!std::is_same_v<Fn, InplaceFunction> &&
+	                                      std::is_invocable_r_v<R, Fn &, Args...>>>
+	InplaceFunction(F &&f) noexcept(std::is_nothrow_constructible_v<Fn, F>)
+	{
+		static_assert(sizeof(Fn) <= Capacity, "callable does not fit the inline buffer: capture less or raise Capacity");
+		static_assert(alignof(Fn) <= alignof(std::max_align_t), "callable is over-aligned");
+		static_assert(std::is_nothrow_move_constructible_v<Fn>, "callable must be nothrow movable");
+
+		::new (static_cast<void *>(buf_)) Fn(std::forward<F>(f));
+		invoke_ = [](void *p, Args &&...a) -> R {
+			// a void slot signature drops whatever the callable returns
+			if constexpr (std::is_void_v<R>)
+				(*static_cast<Fn *>(p))(std::forward<Args>(a)...);
+			else
+				return (*static_cast<Fn *>(p))(std::forward<Args>(a)...);
+		};
+		manage_ = [](void *dst, void *src) noexcept {
+			// move src into dst and destroy src; dst == nullptr only destroys
+			if (dst)
+				::new (dst) Fn(std::move(*static_cast<Fn *>(src)));
+			static_cast<Fn *>(src)->~Fn();
+		};
+	}
+
+	InplaceFunction(InplaceFunction &&other) noexcept { moveFrom(other); }
+
+	InplaceFunction &operator=(InplaceFunction &&other) noexcept
+	{
+		if (this != &other)
+		{
+			reset();
+			moveFrom(other);
+		}
+		return *this;
+	}
+
+	InplaceFunction(const InplaceFunction &) = delete;
+	InplaceFunction &operator=(const InplaceFunction &) = delete;
+
+	~InplaceFunction() { reset(); }
+
+	explicit operator bool() const noexcept { return invoke_ != nullptr; }
+
+	R operator()(Args... a) const
+	{
+		assert(invoke_);
+		return invoke_(buf_, std::forward<Args>(a)...);
+	}
+
+	void reset() noexcept
+	{
+		if (manage_)
+			manage_(nullptr, buf_);
+		invoke_ = nullptr;
+		manage_ = nullptr;
+	}
+
+private:
+	void moveFrom(InplaceFunction &other) noexcept
+	{
+		if (!other.manage_)
+			return;
+		other.manage_(buf_, other.buf_);
+		invoke_ = other.invoke_;
+		manage_ = other.manage_;
+		other.invoke_ = nullptr;
+		other.manage_ = nullptr;
+	}
+
+	R (*invoke_)(void *, Args &&...) = nullptr;
+	void (*manage_)(void *, void *) noexcept = nullptr;
+	alignas(std::max_align_t) mutable unsigned char buf_[Capacity];
+};
+
+template <typename Signature, typename... Slots>
+class FixedSignal;
+
+template <typename... Args, typename... Slots>
+class FixedSignal<void(Args...), Slots...>
+{
+	static_assert((std::is_invocable_v<Slots &, Args &...> && ...), "every slot must accept the signal's arguments");
+
+public:
+	constexpr explicit FixedSignal(Slots... slots) : slots_(std::move(slots)...) {}
+
+	// Calls every slot in order with the same arguments
+	void emit(Args... args)
+	{
+		std::apply([&](auto &...slot) { (slot(args...), ...); }, slots_);
+	}
+
+	static constexpr std::size_t size() { return sizeof...(Slots); }
+
+private:
+	std::tuple<Slots...> slots_;
+};
+
+template <typename... Args, typename... Slots>
+constexpr FixedSignal<void(Args...), std::decay_t<Slots>...> makeFixedSignal(Slots &&...slots)
+{
+	return FixedSignal<void(Args...), std::decay_t<Slots>...>(std::forward<Slots>(slots)...);
+}
+
+template <typename... Args>
+class Signal
+{
+public:
+	using Slot = InplaceFunction<void(Args...)>;
+
+	// Identifies one connection for disconnect; never 0
+	using Connection = std::size_t;
+
+	Signal() = default;
+	explicit Signal(std::size_t capacity) { slots_.reserve(capacity); }
+
+	template <typename F>
+	Connection connect(F &&f)
+	{
+		assert(!emitting_);
+		slots_.push_back(Entry{next_, Slot(std::forward<F>(f))});
+		return next_++;
+	}
+
+	// Calls obj.*Method(args...) on emit; obj must outlive the connection
+	template <auto Method, typename T>
+	Connection connect(T &obj)
+	{
+		return connect([&obj](Args... a) { (obj.*Method)(std::forward<Args>(a)...); });
+	}
+
+	// Returns false if c is not connected
+	bool disconnect(Connection c)
+	{
+		assert(!emitting_);
+		for (auto it = slots_.begin(); it != slots_.end(); ++it)
+		{
+			if (it->id == c)
+			{
+				slots_.erase(it);
+				return true;
+			}
+		}
+		return false;
+	}
+
+	// Calls every slot in connect order with the same arguments
+	void emit(Args... args)
+	{
+#ifndef NDEBUG
+		emitting_ = true;
+#endif
+		for (Entry &e : slots_)
+			e.slot(args...);
+#ifndef NDEBUG
+		emitting_ = false;
+#endif
+	}
+
+	std::size_t size() const { return slots_.size(); }
+	bool empty() const { return slots_.empty(); }
+
+private:
+	struct Entry
+	{
+		Connection id;
+		Slot slot;
+	};
+
+	std::vector<Entry> slots_;
+	Connection next_ = 1;
+#ifndef NDEBUG
+	bool emitting_ = false;
+#endif
+};
+
+} // namespace sigslot
+
+#endif // SIGNAL_HPP_
@@ -1,22 +1,48 @@
 #ifndef SIGNAL_H
 #define SIGNAL_H
 
-#define MAX_SLOTS	10
+#include <stdatomic.h>
+#include <stddef.h>
+#include "../../common/include/rcu.h"
 
 typedef void(*slot_func_t)(void *ctx);
 
 typedef struct {
-	slot_func_t slots[MAX_SLOTS];
-	void *context[MAX_SLOTS];
-	int count;
+	slot_func_t slot;
+	void *ctx;
+} slot_t;
+
+// Immutable once published, except that a connect may fill slots past
+// count and then raise count
+typedef struct {
+	rcu_head_t head;
+	atomic_size_t count;
+	size_t capacity;
+	slot_t slots[];
+} slot_list_t;
+
+typedef struct {
+	_Atomic(slot_list_t *) list;	// NULL until the first connect
+	rcu_t rcu;
 } singal_t;
 
 void signal_init(singal_t *sig);
 
+// Frees the slot list; nothing may emit, connect or disconnect anymore
+void signal_destroy(singal_t *sig);
+
+// Connect and disconnect are safe from any thread, also from inside a
+// slot while the signal is being emitted. They take effect for emits
+// that start after they return; an emit already running keeps the list
+// it started with.
+
+// Returns 0, or -1 if the slot list could not be grown
 int singal_connect(singal_t *sig, slot_func_t slot, void *ctx);
 
+// Lock-free: calls every slot of the current list, in connect order
 void singal_emit(singal_t *sig);
 
+// Removes the first connection of slot. Returns 0, or -1 if there is none.
 int singal_disconnect(singal_t *sig, slot_func_t slot);
 
-#endif // SIGNAL_H
\ No newline at end of file
+#endif // SIGNAL_H
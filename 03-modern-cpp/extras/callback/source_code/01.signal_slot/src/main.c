@@ -38,6 +38,8 @@ int main(void) {
 	printf("---- Emit sig_2 ----\n");
 	singal_emit(&sig_2);
 	
+	signal_destroy(&sig_1);
+	signal_destroy(&sig_2);
 	
 	return 0;
 }
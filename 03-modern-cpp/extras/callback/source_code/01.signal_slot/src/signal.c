@@ -1,43 +1,103 @@
+#include <stdlib.h>
 #include "signal.h"
 #include "string.h"
 
+#define MIN_SLOTS	4
+
+static slot_list_t *list_alloc(size_t capacity) {
+	slot_list_t *l = malloc(sizeof(*l) + capacity * sizeof(l->slots[0]));
+	if(l) {
+		atomic_init(&l->count, 0);
+		l->capacity = capacity;
+	}
+	return l;
+}
+
 void signal_init(singal_t *sig) {
-	memset(sig->slots, 0, sizeof(sig->slots));
-	sig->count = 0;
+	atomic_init(&sig->list, NULL);
+	rcu_init(&sig->rcu);
+}
+
+void signal_destroy(singal_t *sig) {
+	free(atomic_load(&sig->list));
+	atomic_store(&sig->list, NULL);
+	rcu_destroy(&sig->rcu);
 }
 
 int singal_connect(singal_t *sig, slot_func_t slot, void *ctx) {
-	if (sig->count >= MAX_SLOTS) {
-		return -1;
+	rcu_write_lock(&sig->rcu);
+
+	slot_list_t *l = atomic_load_explicit(&sig->list, memory_order_relaxed);
+	size_t n = l ? atomic_load_explicit(&l->count, memory_order_relaxed) : 0;
+
+	if(!l || n == l->capacity) {
+		// full: publish a copy twice the size and retire this one
+		slot_list_t *grown = list_alloc(l ? 2 * l->capacity : MIN_SLOTS);
+		if(!grown) {
+			rcu_write_unlock(&sig->rcu);
+			return -1;
+		}
+		if(l) {
+			memcpy(grown->slots, l->slots, n * sizeof(l->slots[0]));
+		}
+		grown->slots[n].slot = slot;
+		grown->slots[n].ctx = ctx;
+		atomic_init(&grown->count, n + 1);
+		atomic_store(&sig->list, grown);
+		if(l) {
+			rcu_retire(&sig->rcu, &l->head);
+		}
+	} else {
+		// emitters only read below count, so the free entry can be
+		// filled in place and then made visible
+		l->slots[n].slot = slot;
+		l->slots[n].ctx = ctx;
+		atomic_store_explicit(&l->count, n + 1, memory_order_release);
 	}
-	
-	sig->slots[sig->count] = slot;
-	sig->context[sig->count] = ctx;
-		
-	sig->count++;
+
+	rcu_write_unlock(&sig->rcu);
 	return 0;
 }
 
 void singal_emit(singal_t *sig) {
-	for (size_t i = 0; i < sig->count; i++) {
-		sig->slots[i](sig->context[i]);
+	unsigned token = rcu_read_lock(&sig->rcu);
+
+	slot_list_t *l = atomic_load(&sig->list);
+	if(l) {
+		size_t n = atomic_load_explicit(&l->count, memory_order_acquire);
+		for (size_t i = 0; i < n; i++) {
+			l->slots[i].slot(l->slots[i].ctx);
+		}
 	}
+
+	rcu_read_unlock(&sig->rcu, token);
 }
 
 int singal_disconnect(singal_t *sig, slot_func_t slot) {
-	for (size_t i = 0; i < sig->count; i++) {
-		if(sig->slots[i] == slot) {
-			// shift
-			for (size_t j = i; j < sig->count - 1; j++)
-			{
-				sig->slots[j] = sig->slots[j + 1];
-				sig->context[j] = sig->context[j + 1];
+	rcu_write_lock(&sig->rcu);
+
+	slot_list_t *l = atomic_load_explicit(&sig->list, memory_order_relaxed);
+	size_t n = l ? atomic_load_explicit(&l->count, memory_order_relaxed) : 0;
+
+	for (size_t i = 0; i < n; i++) {
+		if(l->slots[i].slot == slot) {
+			// emitters may be walking l: publish a copy without entry i
+			slot_list_t *copy = list_alloc(l->capacity);
+			if(!copy) {
+				rcu_write_unlock(&sig->rcu);
+				return -1;
 			}
-			sig->slots[sig->count - 1] = NULL;
-			sig->context[sig->count - 1] = NULL;
-			sig->count--;
+			memcpy(copy->slots, l->slots, i * sizeof(l->slots[0]));
+			memcpy(copy->slots + i, l->slots + i + 1, (n - i - 1) * sizeof(l->slots[0]));
+			atomic_init(&copy->count, n - 1);
+			atomic_store(&sig->list, copy);
+			rcu_retire(&sig->rcu, &l->head);
+
+			rcu_write_unlock(&sig->rcu);
 			return 0;
 		}
 	}
+
+	rcu_write_unlock(&sig->rcu);
 	return -1;
 }
@@ -0,0 +1,116 @@
+// Publish latency and delivered events/sec with a slow subscriber
+// attached (it busy-waits SLOW_NS per event, like a handler doing I/O or
+// heavy parsing), comparing the synchronous event_bus_publish with the
+// async ring under each full-ring policy and dispatcher count.
+//
+//   gcc -std=c11 -O2 -pthread -Iinclude bench/async_bench.c src/event_bus.c src/event_bus_async.c ../common/src/rcu.c -o async_bench
+//   ./async_bench [events]
+
+#define _POSIX_C_SOURCE 200809L
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "event_bus.h"
+
+#define SLOW_NS	2000
+
+static atomic_size_t delivered;
+
+static long long now_ns(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+static void fast_subscriber(int code) {
+	(void)code;
+	atomic_fetch_add_explicit(&delivered, 1, memory_order_relaxed);
+}
+
+static void slow_subscriber(int code) {
+	(void)code;
+	long long end = now_ns() + SLOW_NS;
+	while(now_ns() < end) {
+	}
+}
+
+static int cmp_ll(const void *a, const void *b) {
+	long long x = *(const long long *)a, y = *(const long long *)b;
+	return (x > y) - (x < y);
+}
+
+static const char *policy_name(event_bus_policy_t p) {
+	switch(p) {
+	case EVENT_BUS_BLOCK:		return "block";
+	case EVENT_BUS_DROP_OLDEST:	return "drop-oldest";
+	case EVENT_BUS_DROP_NEWEST:	return "drop-newest";
+	}
+	return "?";
+}
+
+// n_threads == 0 runs the synchronous publish
+static void run(size_t n, size_t n_threads, event_bus_policy_t policy, long long *lat) {
+	static event_bus_async_t async;
+	event_bus_t bus;
+
+	event_bus_init(&bus);
+	event_bus_subscribe(&bus, fast_subscriber);
+	event_bus_subscribe(&bus, slow_subscriber);
+	atomic_store(&delivered, 0);
+
+	if(n_threads && event_bus_start_async(&bus, &async, n_threads, policy) != 0) {
+		fprintf(stderr, "event_bus_start_async failed\n");
+		exit(EXIT_FAILURE);
+	}
+
+	long long start = now_ns();
+	for(size_t i = 0; i < n; i++) {
+		long long t0 = now_ns();
+		if(n_threads) {
+			event_bus_publish_async(&bus, (int)i);
+		} else {
+			event_bus_publish(&bus, (int)i);
+		}
+		lat[i] = now_ns() - t0;
+	}
+	long long published = now_ns();
+	size_t dropped = event_bus_dropped(&bus);
+	event_bus_stop_async(&bus);
+	event_bus_destroy(&bus);
+	double total = (now_ns() - start) / 1e9;
+
+	qsort(lat, n, sizeof(*lat), cmp_ll);
+	char mode[32];
+	if(n_threads) {
+		snprintf(mode, sizeof(mode), "async x%zu %s", n_threads, policy_name(policy));
+	} else {
+		snprintf(mode, sizeof(mode), "sync");
+	}
+	printf("%-24s %8lld %8lld %10lld %10.0f %10.0f %9zu %8zu\n", mode,
+	       lat[n / 2], lat[n * 99 / 100], lat[n - 1],
+	       n / ((published - start) / 1e9), atomic_load(&delivered) / total,
+	       atomic_load(&delivered), dropped);
+}
+
+int main(int argc, char **argv) {
+	size_t n = argc > 1 ? strtoull(argv[1], NULL, 10) : 100000;
+	long long *lat = malloc(n * sizeof(*lat));
+	if(!lat) {
+		return EXIT_FAILURE;
+	}
+
+	printf("%zu events, slow subscriber %d ns, ring %d\n", n, SLOW_NS, EVENT_BUS_RING_SIZE);
+	printf("%-24s %8s %8s %10s %10s %10s %9s %8s\n", "mode", "p50 ns", "p99 ns", "max ns",
+	       "publish/s", "deliver/s", "delivered", "dropped");
+
+	run(n, 0, EVENT_BUS_BLOCK, lat);
+	for(size_t t = 1; t <= MAX_DISPATCHERS; t *= 2) {
+		run(n, t, EVENT_BUS_BLOCK, lat);
+		run(n, t, EVENT_BUS_DROP_OLDEST, lat);
+		run(n, t, EVENT_BUS_DROP_NEWEST, lat);
+	}
+
+	free(lat);
+	return 0;
+}
@@ -0,0 +1,124 @@
+// Throughput of bursts: n calls of event_bus_publish against one
+// event_bus_publish_batch, with the same 8 subscribers taking single
+// events (through the adapter) or spans (event_bus_subscribe_batch).
+// Each subscriber sums the codes it sees; the sums are checked against
+// each other.
+//
+//   gcc -std=c11 -O2 -pthread -Iinclude bench/batch_bench.c src/event_bus.c ../common/src/rcu.c -o batch_bench
+//   ./batch_bench [burst] [bursts]
+
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "event_bus.h"
+
+#define N_SUBS	8
+
+// event_cb_t has no ctx, so each single-event subscriber is its own
+// function with its own total
+static long long single_sum[N_SUBS];
+
+#define SINGLE(i) static void single_##i(int code) { single_sum[i] += code; }
+SINGLE(0) SINGLE(1) SINGLE(2) SINGLE(3) SINGLE(4) SINGLE(5) SINGLE(6) SINGLE(7)
+
+static const event_cb_t singles[N_SUBS] = {
+	single_0, single_1, single_2, single_3, single_4, single_5, single_6, single_7,
+};
+
+static long long batch_sum[N_SUBS];
+
+static void on_batch(const int *codes, size_t n, void *ctx) {
+	long long s = 0;
+	for(size_t i = 0; i < n; i++) {
+		s += codes[i];
+	}
+	*(long long *)ctx += s;
+}
+
+static double now_s(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Returns the sum every subscriber must have seen, or -1 if one differs
+static long long collect(void) {
+	long long expect = -1;
+	for(size_t i = 0; i < N_SUBS; i++) {
+		long long s = single_sum[i] + batch_sum[i];
+		if(expect >= 0 && s != expect) {
+			return -1;
+		}
+		expect = s;
+		single_sum[i] = batch_sum[i] = 0;
+	}
+	return expect;
+}
+
+static long long run(const char *name, int batch_subs, int batch_publish,
+                     const int *codes, size_t burst, size_t bursts) {
+	event_bus_t bus;
+
+	event_bus_init(&bus);
+	for(size_t i = 0; i < N_SUBS; i++) {
+		if(batch_subs) {
+			event_bus_subscribe_batch(&bus, on_batch, &batch_sum[i]);
+		} else {
+			event_bus_subscribe(&bus, singles[i]);
+		}
+	}
+
+	double t0 = now_s();
+	for(size_t b = 0; b < bursts; b++) {
+		if(batch_publish) {
+			event_bus_publish_batch(&bus, codes, burst);
+		} else {
+			for(size_t i = 0; i < burst; i++) {
+				event_bus_publish(&bus, codes[i]);
+			}
+		}
+	}
+	double secs = now_s() - t0;
+
+	event_bus_destroy(&bus);
+	long long sum = collect();
+	printf("%-34s %10.2f %14.1f\n", name, secs * 1e9 / (double)(burst * bursts),
+	       burst * bursts / secs / 1e6);
+	return sum;
+}
+
+int main(int argc, char **argv) {
+	size_t burst = argc > 1 ? strtoul(argv[1], NULL, 10) : 4096;
+	size_t bursts = argc > 2 ? strtoul(argv[2], NULL, 10) : 2000;
+	if(burst == 0) {
+		return EXIT_FAILURE;
+	}
+
+	int *codes = malloc(burst * sizeof(*codes));
+	if(!codes) {
+		return EXIT_FAILURE;
+	}
+	srand(25);
+	for(size_t i = 0; i < burst; i++) {
+		codes[i] = rand() % 1000;
+	}
+
+	printf("%d subscribers, bursts of %zu codes, %zu bursts\n\n", N_SUBS, burst, bursts);
+	printf("%-34s %10s %14s\n", "", "ns/event", "Mevents/s");
+
+	long long s[4];
+	s[0] = run("publish x n, single subscribers", 0, 0, codes, burst, bursts);
+	s[1] = run("publish_batch, single (adapter)", 0, 1, codes, burst, bursts);
+	s[2] = run("publish x n, batch subscribers", 1, 0, codes, burst, bursts);
+	s[3] = run("publish_batch, batch subscribers", 1, 1, codes, burst, bursts);
+
+	free(codes);
+	for(int i = 0; i < 4; i++) {
+		if(s[i] < 0 || s[i] != s[0]) {
+			fprintf(stderr, "subscriber totals differ\n");
+			return EXIT_FAILURE;
+		}
+	}
+	return 0;
+}
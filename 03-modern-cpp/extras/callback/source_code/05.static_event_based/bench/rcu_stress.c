@@ -0,0 +1,151 @@
+// Publishing while other threads subscribe and unsubscribe. Publisher
+// threads send topic events; churn threads keep adding and removing
+// subscribers on random topics, half of them topics nobody else uses, so
+// that far more than MAX_TOPICS distinct topics come and go. One
+// permanent subscriber re-subscribes itself from inside its handler.
+// Every publish must reach each permanent subscriber of its topic exactly
+// once, and no subscribe may fail; both are checked at the end.
+//
+//   gcc -std=c11 -O2 -pthread -Iinclude bench/rcu_stress.c src/event_bus.c ../common/src/rcu.c -o rcu_stress
+//   ./rcu_stress [publishers] [churners] [topics] [seconds]
+
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "event_bus.h"
+
+#define PERMANENT_PER_TOPIC	4
+
+static event_bus_t bus;
+static atomic_bool stop;
+static size_t n_topics;
+
+// per topic: publishes made, and deliveries to its permanent subscribers
+static atomic_size_t *published;
+static atomic_size_t *delivered;
+static atomic_size_t churn_hits;
+static atomic_size_t resubscribes;
+static atomic_size_t failed_subscribes;
+
+static void on_permanent(int topic, const void *payload, void *ctx) {
+	(void)payload;
+	(void)ctx;
+	atomic_fetch_add_explicit(&delivered[topic], 1, memory_order_relaxed);
+}
+
+static void on_churn(int topic, const void *payload, void *ctx) {
+	(void)topic;
+	(void)payload;
+	(void)ctx;
+	atomic_fetch_add_explicit(&churn_hits, 1, memory_order_relaxed);
+}
+
+// Moves itself to the end of topic 0's list on every event: unsubscribe
+// and subscribe inside a publish, whose old lists must outlive it
+static void on_self_move(int topic, const void *payload, void *ctx) {
+	(void)payload;
+	event_bus_unsubscribe_topic(&bus, topic, on_self_move, ctx);
+	event_bus_subscribe_topic(&bus, topic, on_self_move, ctx);
+	atomic_fetch_add_explicit(&resubscribes, 1, memory_order_relaxed);
+}
+
+typedef struct {
+	unsigned seed;
+	size_t   ops;
+} worker_t;
+
+static void *publisher_main(void *arg) {
+	worker_t *w = arg;
+
+	while(!atomic_load_explicit(&stop, memory_order_relaxed)) {
+		int topic = (int)(rand_r(&w->seed) % n_topics);
+		atomic_fetch_add_explicit(&published[topic], 1, memory_order_relaxed);
+		event_bus_publish_topic(&bus, topic, NULL);
+		w->ops++;
+	}
+	return NULL;
+}
+
+static void *churner_main(void *arg) {
+	worker_t *w = arg;
+
+	while(!atomic_load_explicit(&stop, memory_order_relaxed)) {
+		int topic = (int)(rand_r(&w->seed) % n_topics);
+		if(w->ops & 2) {
+			// a short-lived topic of its own
+			topic += (int)n_topics + (int)(rand_r(&w->seed) % (64 * MAX_TOPICS));
+		}
+		if(event_bus_subscribe_topic(&bus, topic, on_churn, w) != 0) {
+			atomic_fetch_add_explicit(&failed_subscribes, 1, memory_order_relaxed);
+		}
+		event_bus_unsubscribe_topic(&bus, topic, on_churn, w);
+		w->ops += 2;
+	}
+	return NULL;
+}
+
+int main(int argc, char **argv) {
+	size_t n_pub   = argc > 1 ? strtoul(argv[1], NULL, 10) : 4;
+	size_t n_churn = argc > 2 ? strtoul(argv[2], NULL, 10) : 2;
+	n_topics       = argc > 3 ? strtoul(argv[3], NULL, 10) : 64;
+	double secs    = argc > 4 ? atof(argv[4]) : 1.0;
+	if(n_topics == 0 || n_topics > MAX_TOPICS) {
+		fprintf(stderr, "1 to %d topics\n", MAX_TOPICS);
+		return EXIT_FAILURE;
+	}
+
+	published = calloc(n_topics, sizeof(*published));
+	delivered = calloc(n_topics, sizeof(*delivered));
+	worker_t *w = calloc(n_pub + n_churn, sizeof(*w));
+	pthread_t *t = calloc(n_pub + n_churn, sizeof(*t));
+	if(!(published && delivered && w && t)) {
+		return EXIT_FAILURE;
+	}
+
+	event_bus_init(&bus);
+	for(size_t i = 0; i < n_topics; i++) {
+		for(int k = 0; k < PERMANENT_PER_TOPIC; k++) {
+			event_bus_subscribe_topic(&bus, (int)i, on_permanent, NULL);
+		}
+	}
+	event_bus_subscribe_topic(&bus, 0, on_self_move, NULL);
+
+	for(size_t i = 0; i < n_pub + n_churn; i++) {
+		w[i].seed = (unsigned)i + 1;
+		pthread_create(&t[i], NULL, i < n_pub ? publisher_main : churner_main, &w[i]);
+	}
+	struct timespec ts = { (time_t)secs, (long)((secs - (time_t)secs) * 1e9) };
+	nanosleep(&ts, NULL);
+	atomic_store(&stop, 1);
+
+	size_t pubs = 0, churns = 0;
+	for(size_t i = 0; i < n_pub + n_churn; i++) {
+		pthread_join(t[i], NULL);
+		if(i < n_pub) {
+			pubs += w[i].ops;
+		} else {
+			churns += w[i].ops;
+		}
+	}
+
+	size_t bad = 0;
+	for(size_t i = 0; i < n_topics; i++) {
+		bad += atomic_load(&delivered[i]) != PERMANENT_PER_TOPIC * atomic_load(&published[i]);
+	}
+
+	printf("%zu publishers, %zu churn threads, %zu topics, %.1f s\n\n", n_pub, n_churn, n_topics, secs);
+	printf("publishes          %12.0f /s\n", pubs / secs);
+	printf("subscribe/unsub    %12.0f /s\n", churns / 2 / secs);
+	printf("self-moves         %12zu\n", atomic_load(&resubscribes));
+	printf("churn deliveries   %12zu\n", atomic_load(&churn_hits));
+	printf("topics miscounted  %12zu\n", bad);
+	printf("failed subscribes  %12zu\n", atomic_load(&failed_subscribes));
+
+	event_bus_destroy(&bus);
+	free(t);
+	free(w);
+	free(delivered);
+	free(published);
+	return bad || atomic_load(&failed_subscribes) ? EXIT_FAILURE : 0;
+}
@@ -0,0 +1,137 @@
+// Publish cost with hundreds of topics and thousands of subscribers:
+// topic-indexed dispatch (event_bus_publish_topic) against the flat
+// broadcast the bus had before, where every subscriber is called for
+// every event and filters the code itself. The flat table is built here
+// with the same subscribers. Each event carries a small struct by
+// pointer.
+//
+//   gcc -std=c11 -O2 -pthread -Iinclude bench/topic_bench.c src/event_bus.c ../common/src/rcu.c -o topic_bench
+//   ./topic_bench [topics] [subscribers] [events]
+
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "event_bus.h"
+
+typedef struct {
+	int    id;
+	double value;
+} reading_t;
+
+typedef struct {
+	int    topic;
+	double sum;
+	size_t hits;
+} listener_t;
+
+typedef struct {
+	void (*fn)(int code, const void *payload, void *ctx);
+	void  *ctx;
+} flat_sub_t;
+
+static event_bus_t bus;
+static listener_t *listeners;
+static flat_sub_t *flat;
+
+static double now_s(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void on_reading(int topic, const void *payload, void *ctx) {
+	listener_t *l = ctx;
+	(void)topic;
+	l->sum += ((const reading_t *)payload)->value;
+	l->hits++;
+}
+
+// The broadcast handler has to check whether the event is its own
+static void on_any(int code, const void *payload, void *ctx) {
+	listener_t *l = ctx;
+	if(code != l->topic) {
+		return;
+	}
+	l->sum += ((const reading_t *)payload)->value;
+	l->hits++;
+}
+
+static size_t total_hits(size_t n_subs) {
+	size_t hits = 0;
+	for(size_t i = 0; i < n_subs; i++) {
+		hits += listeners[i].hits;
+		listeners[i].hits = 0;
+	}
+	return hits;
+}
+
+int main(int argc, char **argv) {
+	size_t n_topics = argc > 1 ? strtoull(argv[1], NULL, 10) : 256;
+	size_t n_subs = argc > 2 ? strtoull(argv[2], NULL, 10) : 4096;
+	size_t n_events = argc > 3 ? strtoull(argv[3], NULL, 10) : 200000;
+	if(n_topics > MAX_TOPICS || n_topics == 0) {
+		fprintf(stderr, "1 to %d topics\n", MAX_TOPICS);
+		return EXIT_FAILURE;
+	}
+
+	listeners = calloc(n_subs, sizeof(*listeners));
+	flat = calloc(n_subs, sizeof(*flat));
+	if(!(listeners && flat)) {
+		return EXIT_FAILURE;
+	}
+
+	// topic ids are sparse, as event codes usually are; subscribers are
+	// spread over the topics at random
+	srand(22);
+	event_bus_init(&bus);
+	for(size_t i = 0; i < n_subs; i++) {
+		listeners[i].topic = (int)(rand() % n_topics) * 37 + 1000;
+		flat[i].fn = on_any;
+		flat[i].ctx = &listeners[i];
+		if(event_bus_subscribe_topic(&bus, listeners[i].topic, on_reading, &listeners[i]) != 0) {
+			fprintf(stderr, "subscribe failed\n");
+			return EXIT_FAILURE;
+		}
+	}
+
+	int *codes = malloc(n_events * sizeof(*codes));
+	if(!codes) {
+		return EXIT_FAILURE;
+	}
+	for(size_t i = 0; i < n_events; i++) {
+		codes[i] = (int)(rand() % n_topics) * 37 + 1000;
+	}
+
+	printf("%zu topics, %zu subscribers, %zu events\n\n", n_topics, n_subs, n_events);
+
+	reading_t r = {0, 0.5};
+	double t0 = now_s();
+	for(size_t i = 0; i < n_events; i++) {
+		r.id = (int)i;
+		for(size_t s = 0; s < n_subs; s++) {
+			flat[s].fn(codes[i], &r, flat[s].ctx);
+		}
+	}
+	double flat_s = now_s() - t0;
+	size_t flat_hits = total_hits(n_subs);
+
+	t0 = now_s();
+	for(size_t i = 0; i < n_events; i++) {
+		r.id = (int)i;
+		event_bus_publish_topic(&bus, codes[i], &r);
+	}
+	double topic_s = now_s() - t0;
+	size_t topic_hits = total_hits(n_subs);
+
+	printf("%-16s %12s %14s %12s\n", "dispatch", "ns/publish", "handler calls", "deliveries");
+	printf("%-16s %12.1f %14zu %12zu\n", "flat broadcast", flat_s / n_events * 1e9, n_events * n_subs, flat_hits);
+	printf("%-16s %12.1f %14zu %12zu\n", "topic-indexed", topic_s / n_events * 1e9, topic_hits, topic_hits);
+	printf("\nspeedup x%.1f\n", flat_s / topic_s);
+
+	event_bus_destroy(&bus);
+	free(codes);
+	free(flat);
+	free(listeners);
+	return flat_hits == topic_hits ? 0 : EXIT_FAILURE;
+}
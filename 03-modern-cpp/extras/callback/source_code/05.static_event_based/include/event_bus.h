@@ -1,24 +1,189 @@
 #ifndef EVENT_BUS_H
 #define EVENT_BUS_H
 
+#include <pthread.h>
+#include <stdatomic.h>
 #include <stddef.h>
 #include <string.h>
+#include "../../common/include/rcu.h"
 
-#define MAX_SUBSCRIBERS	10
+// Topics that have subscribers at the same time; a topic whose last
+// subscriber leaves no longer counts
+#define MAX_TOPICS	512
+
+// Async mode: events queued per bus (a power of two) and dispatcher threads
+#define EVENT_BUS_RING_SIZE	1024
+#define MAX_DISPATCHERS	4
 
 typedef void (*event_cb_t)(int code);
 
+// A topic subscriber: payload is whatever the publisher passed for this
+// event (NULL from event_bus_publish), ctx what was given at subscribe
+typedef void (*event_handler_t)(int topic, const void *payload, void *ctx);
+
+// A batch subscriber: gets codes[0 .. n) in one call
+typedef void (*event_batch_cb_t)(const int *codes, size_t n, void *ctx);
+
+// cb for event_bus_subscribe, batch and ctx for event_bus_subscribe_batch,
+// fn and ctx for a topic subscription
+typedef struct {
+	event_cb_t       cb;
+	event_batch_cb_t batch;
+	event_handler_t  fn;
+	void            *ctx;
+} event_sub_t;
+
+// Published with an atomic store and read without locks, so immutable
+// once published, except that a subscribe may fill subs past count and
+// then raise count. Replaced copies are freed through the bus's rcu.
+typedef struct {
+	rcu_head_t    head;
+	int           topic;	// whose subscribers these are, for a topic list
+	atomic_size_t count;
+	size_t        capacity;
+	event_sub_t   subs[];
+} event_sub_list_t;
+
+// One slot of the topic hash table: never used, holding a topic's list,
+// or a tombstone (used, subs NULL) left when a topic lost its last
+// subscriber. Publishers probe past tombstones; subscribers reuse them.
+typedef struct {
+	atomic_int                  used;
+	_Atomic(event_sub_list_t *) subs;
+} event_topic_t;
+
+// Open-addressed by topic, at most half used. When live topics and
+// tombstones fill that half, a compacted copy is published and this one
+// retired, so a slot never changes under a publisher's probe.
 typedef struct {
-	event_cb_t sub[MAX_SUBSCRIBERS];
-	size_t     count;
+	rcu_head_t    head;
+	size_t        n_used;	// slots ever used: live topics and tombstones
+	event_topic_t slots[2 * MAX_TOPICS];
+} event_topic_table_t;
+
+struct event_bus_async;
+
+typedef struct {
+	_Atomic(event_sub_list_t *) subs;	// NULL until the first subscribe
+	struct event_bus_async *async;
+
+	_Atomic(event_topic_table_t *) topics;	// NULL until the first topic
+	size_t            n_topics;	// topics with subscribers
+
+	// publishers are readers; subscribe/unsubscribe take the write lock
+	rcu_t             rcu;
 } event_bus_t;
 
+// What event_bus_publish_async does when the ring is full
+typedef enum {
+	EVENT_BUS_BLOCK,	// wait for a dispatcher to free a slot
+	EVENT_BUS_DROP_OLDEST,	// discard the oldest queued event, queue this one
+	EVENT_BUS_DROP_NEWEST,	// discard this event
+} event_bus_policy_t;
+
+typedef struct {
+	atomic_size_t seq;
+	int           code;
+} event_bus_cell_t;
+
+// State of the async mode. The caller owns it (static storage is fine)
+// and must keep it alive until event_bus_stop_async returns.
+typedef struct event_bus_async {
+	event_bus_t        *bus;
+	event_bus_policy_t  policy;
+
+	// bounded lock-free multi-producer/multi-consumer ring: each cell's
+	// sequence number says whether it is free for the producer at that
+	// position or full for the consumer at that position
+	event_bus_cell_t    ring[EVENT_BUS_RING_SIZE];
+	atomic_size_t       head;
+	atomic_size_t       tail;
+
+	// idle dispatchers and blocked publishers sleep here; the lock-free
+	// paths only touch the mutex when someone is asleep
+	pthread_mutex_t     lock;
+	pthread_cond_t      not_empty;
+	pthread_cond_t      not_full;
+	atomic_size_t       idle_dispatchers;
+	atomic_size_t       blocked_publishers;
+	atomic_bool         stopping;
+
+	atomic_size_t       dropped;
+
+	pthread_t           threads[MAX_DISPATCHERS];
+	size_t              n_threads;
+} event_bus_async_t;
+
 
 void event_bus_init(event_bus_t *bus);
 
+// Frees the subscriber lists. Stop async mode first; nothing may publish
+// or subscribe anymore.
+void event_bus_destroy(event_bus_t *bus);
+
+// Subscribing and unsubscribing are safe from any thread, also from a
+// subscriber while an event is being delivered or with async mode
+// running. A change applies to publishes that start after it returns;
+// one already running keeps delivering to the list it started with.
+
+// Returns 0, -1 on bad arguments, -2 if the list could not be grown.
 int event_bus_subscribe(event_bus_t *bus, event_cb_t cb);
 
+// Subscribes fn(codes, n, ctx) to every event, delivered as spans: a
+// whole event_bus_publish_batch in one call, any other publish as a span
+// of one. The span is only borrowed for the duration of the call.
+// Returns 0, -1 on bad arguments, -2 if the list could not be grown.
+int event_bus_subscribe_batch(event_bus_t *bus, event_batch_cb_t fn, void *ctx);
+
+// Calls every event_bus_subscribe and event_bus_subscribe_batch
+// subscriber, then the subscribers of topic code (with a NULL payload)
 void event_bus_publish(event_bus_t *bus, int code);
 
+// Publishes codes[0 .. n) as one burst: each batch subscriber is called
+// once with the whole span, each event_bus_subscribe subscriber once per
+// code, then the topic subscribers of each code. Every subscriber sees
+// the codes in order, but goes through all of them before the next
+// subscriber starts, unlike n calls of event_bus_publish.
+void event_bus_publish_batch(event_bus_t *bus, const int *codes, size_t n);
+
+// Subscribes fn(topic, payload, ctx) to one topic.
+// Returns 0, -1 on bad arguments, -2 if more than MAX_TOPICS topics
+// would have subscribers or memory ran out.
+int event_bus_subscribe_topic(event_bus_t *bus, int topic, event_handler_t fn, void *ctx);
+
+// Removes the first subscription of fn with ctx to topic; after the last
+// one the topic no longer counts towards MAX_TOPICS.
+// Returns 0, or -1 if there is none.
+int event_bus_unsubscribe_topic(event_bus_t *bus, int topic, event_handler_t fn, void *ctx);
+
+// Calls every event_bus_subscribe and event_bus_subscribe_batch
+// subscriber with topic as the code, then the subscribers of topic
+// with payload, found by one hash lookup. payload is only borrowed for
+// the duration of the call.
+void event_bus_publish_topic(event_bus_t *bus, int topic, const void *payload);
+
+// Starts n_threads (1..MAX_DISPATCHERS) dispatcher threads that deliver
+// events queued by event_bus_publish_async. With one dispatcher events
+// arrive in publish order; with more, subscribers run concurrently and
+// may see events out of order.
+// Returns 0, -1 on bad arguments, -2 if already started, -3 if a thread
+// could not be created.
+int event_bus_start_async(event_bus_t *bus, event_bus_async_t *async,
+                          size_t n_threads, event_bus_policy_t policy);
+
+// Queues code for the dispatchers and returns without calling any
+// subscriber. Safe from any number of threads, but not from a subscriber
+// under EVENT_BUS_BLOCK: with the ring full it would wait for itself.
+// Returns 0 if queued, -1 if async mode is not running, -2 if the ring
+// was full and the policy is EVENT_BUS_DROP_NEWEST.
+int event_bus_publish_async(event_bus_t *bus, int code);
+
+// Events dropped by the full-ring policy since event_bus_start_async
+size_t event_bus_dropped(const event_bus_t *bus);
+
+// Delivers everything still queued, then joins the dispatchers. Call it
+// once no thread is publishing anymore.
+void event_bus_stop_async(event_bus_t *bus);
+
 
 #endif // EVENT_BUS_H
@@ -1,11 +1,226 @@
+#include <stdint.h>
+#include <stdlib.h>
 #include "event_bus.h"
 
+#define TOPIC_SLOTS	(2 * MAX_TOPICS)
+#define TOPIC_SLOT_BITS	10
+#define MIN_SUBS	4
+
+_Static_assert(TOPIC_SLOTS == 1 << TOPIC_SLOT_BITS, "TOPIC_SLOT_BITS must be log2(2 * MAX_TOPICS)");
+
+// Fibonacci hashing: the top bits of the product depend on every bit of
+// topic, so consecutive ids spread over the table
+static size_t topic_hash(int topic) {
+	return ((uint32_t)topic * 2654435769u) >> (32 - TOPIC_SLOT_BITS);
+}
+
+// Publisher side: topic's list in tab, or NULL. Subscribers change slots
+// meanwhile, so a slot is only trusted through its list's own topic.
+// Probing stops at a never-used slot, or after a lap of a table whose
+// used half is all tombstones.
+static event_sub_list_t *topic_find(event_topic_table_t *tab, int topic) {
+	size_t i = topic_hash(topic);
+
+	for(size_t k = 0; k < TOPIC_SLOTS; k++) {
+		event_topic_t *t = &tab->slots[i];
+		if(!atomic_load_explicit(&t->used, memory_order_acquire)) {
+			return NULL;
+		}
+		event_sub_list_t *l = atomic_load(&t->subs);
+		if(l && l->topic == topic) {
+			return l;
+		}
+		i = (i + 1) & (TOPIC_SLOTS - 1);
+	}
+	return NULL;
+}
+
+// Subscriber side, write lock held: the slot holding topic, or NULL with
+// *free_slot set to the first tombstone or never-used slot on its probe
+// path (NULL if there is neither)
+static event_topic_t *topic_slot_locked(event_topic_table_t *tab, int topic, event_topic_t **free_slot) {
+	size_t i = topic_hash(topic);
+
+	*free_slot = NULL;
+	for(size_t k = 0; k < TOPIC_SLOTS; k++) {
+		event_topic_t *t = &tab->slots[i];
+		event_sub_list_t *l = atomic_load_explicit(&t->subs, memory_order_relaxed);
+		if(l && l->topic == topic) {
+			return t;
+		}
+		if(!l && !*free_slot) {
+			*free_slot = t;
+		}
+		if(!atomic_load_explicit(&t->used, memory_order_relaxed)) {
+			return NULL;
+		}
+		i = (i + 1) & (TOPIC_SLOTS - 1);
+	}
+	return NULL;
+}
+
+// Write lock held: publishes a copy of old (or an empty table) holding
+// only the live topics, and retires old. Returns the copy, or NULL.
+static event_topic_table_t *table_rebuild(event_bus_t *bus, event_topic_table_t *old) {
+	event_topic_table_t *tab = malloc(sizeof(*tab));
+	if(!tab) {
+		return NULL;
+	}
+
+	tab->n_used = 0;
+	for(size_t i = 0; i < TOPIC_SLOTS; i++) {
+		atomic_init(&tab->slots[i].used, 0);
+		atomic_init(&tab->slots[i].subs, NULL);
+	}
+
+	for(size_t i = 0; old && i < TOPIC_SLOTS; i++) {
+		event_sub_list_t *l = atomic_load_explicit(&old->slots[i].subs, memory_order_relaxed);
+		if(!l) {
+			continue;
+		}
+		size_t j = topic_hash(l->topic);
+		while(atomic_load_explicit(&tab->slots[j].used, memory_order_relaxed)) {
+			j = (j + 1) & (TOPIC_SLOTS - 1);
+		}
+		atomic_init(&tab->slots[j].used, 1);
+		atomic_init(&tab->slots[j].subs, l);
+		tab->n_used++;
+	}
+
+	atomic_store(&bus->topics, tab);
+	if(old) {
+		// only the table: its lists now belong to the copy
+		rcu_retire(&bus->rcu, &old->head);
+	}
+	return tab;
+}
+
+static event_sub_list_t *list_alloc(size_t capacity, int topic) {
+	event_sub_list_t *l = malloc(sizeof(*l) + capacity * sizeof(l->subs[0]));
+	if(l) {
+		l->topic = topic;
+		atomic_init(&l->count, 0);
+		l->capacity = capacity;
+	}
+	return l;
+}
+
+// Appends s to *slot, in place while there is room, otherwise by
+// publishing a copy twice the size (a new list for topic if *slot is
+// NULL). Write lock held. Returns 0 or -1.
+static int list_add(event_bus_t *bus, _Atomic(event_sub_list_t *) *slot, const event_sub_t *s, int topic) {
+	event_sub_list_t *l = atomic_load_explicit(slot, memory_order_relaxed);
+	size_t n = l ? atomic_load_explicit(&l->count, memory_order_relaxed) : 0;
+
+	if(l && n < l->capacity) {
+		// publishers only read below count
+		l->subs[n] = *s;
+		atomic_store_explicit(&l->count, n + 1, memory_order_release);
+		return 0;
+	}
+
+	event_sub_list_t *grown = list_alloc(l ? 2 * l->capacity : MIN_SUBS, topic);
+	if(!grown) {
+		return -1;
+	}
+	if(l) {
+		memcpy(grown->subs, l->subs, n * sizeof(l->subs[0]));
+	}
+	grown->subs[n] = *s;
+	atomic_init(&grown->count, n + 1);
+	atomic_store(slot, grown);
+	if(l) {
+		rcu_retire(&bus->rcu, &l->head);
+	}
+	return 0;
+}
+
+// Publishes a copy of *slot without its first entry equal to s, or NULL
+// instead of an empty list. Write lock held. Returns 0, or -1 if there is
+// none or no memory for the copy.
+static int list_remove(event_bus_t *bus, _Atomic(event_sub_list_t *) *slot, const event_sub_t *s) {
+	event_sub_list_t *l = atomic_load_explicit(slot, memory_order_relaxed);
+	size_t n = l ? atomic_load_explicit(&l->count, memory_order_relaxed) : 0;
+
+	for(size_t i = 0; i < n; i++) {
+		if(l->subs[i].cb == s->cb && l->subs[i].batch == s->batch &&
+		   l->subs[i].fn == s->fn && l->subs[i].ctx == s->ctx) {
+			event_sub_list_t *copy = NULL;
+			if(n > 1) {
+				copy = list_alloc(l->capacity, l->topic);
+				if(!copy) {
+					return -1;
+				}
+				memcpy(copy->subs, l->subs, i * sizeof(l->subs[0]));
+				memcpy(copy->subs + i, l->subs + i + 1, (n - i - 1) * sizeof(l->subs[0]));
+				atomic_init(&copy->count, n - 1);
+			}
+			atomic_store(slot, copy);
+			rcu_retire(&bus->rcu, &l->head);
+			return 0;
+		}
+	}
+	return -1;
+}
+
+// Inside a read section: calls the subscribers of topic code
+static void publish_topic_locked(event_bus_t *bus, int code, const void *payload) {
+	event_topic_table_t *tab = atomic_load(&bus->topics);
+	event_sub_list_t *l = tab ? topic_find(tab, code) : NULL;
+	if(l) {
+		size_t n = atomic_load_explicit(&l->count, memory_order_acquire);
+		for(size_t i = 0; i < n; i++) {
+			l->subs[i].fn(code, payload, l->subs[i].ctx);
+		}
+	}
+}
+
+// Inside a read section: hands codes[0 .. n) to every subscriber of the
+// whole bus. Single-event subscribers are adapted with a loop over the
+// span, so one publish is just a batch of one.
+static void publish_all_locked(event_bus_t *bus, const int *codes, size_t n) {
+	event_sub_list_t *l = atomic_load(&bus->subs);
+	if(!l) {
+		return;
+	}
+
+	size_t count = atomic_load_explicit(&l->count, memory_order_acquire);
+	for(size_t i = 0; i < count; i++) {
+		const event_sub_t *s = &l->subs[i];
+		if(s->batch) {
+			s->batch(codes, n, s->ctx);
+		} else {
+			for(size_t k = 0; k < n; k++) {
+				s->cb(codes[k]);
+			}
+		}
+	}
+}
+
 void event_bus_init(event_bus_t *bus) {
 	if(!bus) {
 		return;
 	}
-	memset(bus->sub, 0, sizeof(bus->sub));
-	bus->count = 0;
+	atomic_init(&bus->subs, NULL);
+	bus->async = NULL;
+	atomic_init(&bus->topics, NULL);
+	bus->n_topics = 0;
+	rcu_init(&bus->rcu);
+}
+
+void event_bus_destroy(event_bus_t *bus) {
+	if(!bus) {
+		return;
+	}
+	free(atomic_load(&bus->subs));
+	atomic_store(&bus->subs, NULL);
+	event_topic_table_t *tab = atomic_load(&bus->topics);
+	for(size_t i = 0; tab && i < TOPIC_SLOTS; i++) {
+		free(atomic_load(&tab->slots[i].subs));
+	}
+	free(tab);
+	atomic_store(&bus->topics, NULL);
+	rcu_destroy(&bus->rcu);
 }
 
 int event_bus_subscribe(event_bus_t *bus, event_cb_t cb) {
@@ -13,13 +228,13 @@ int event_bus_subscribe(event_bus_t *bus, event_cb_t cb) {
 		return -1;
 	}
 
-	if(bus->count >= MAX_SUBSCRIBERS) {
-		return -2;
-	}
+	event_sub_t s = { cb, NULL, NULL, NULL };
 
-	bus->sub[bus->count++] = cb;
+	rcu_write_lock(&bus->rcu);
+	int err = list_add(bus, &bus->subs, &s, 0);
+	rcu_write_unlock(&bus->rcu);
 
-	return 0;
+	return err ? -2 : 0;
 }
 
 void event_bus_publish(event_bus_t *bus, int code) {
@@ -27,7 +242,110 @@ void event_bus_publish(event_bus_t *bus, int code) {
 		return;
 	}
 
-	for(size_t i = 0; i < bus->count; i++) {
-		bus->sub[i](code);
+	unsigned token = rcu_read_lock(&bus->rcu);
+	publish_all_locked(bus, &code, 1);
+	publish_topic_locked(bus, code, NULL);
+	rcu_read_unlock(&bus->rcu, token);
+}
+
+int event_bus_subscribe_batch(event_bus_t *bus, event_batch_cb_t fn, void *ctx) {
+	if(!(bus && fn)) {
+		return -1;
+	}
+
+	event_sub_t s = { NULL, fn, NULL, ctx };
+
+	rcu_write_lock(&bus->rcu);
+	int err = list_add(bus, &bus->subs, &s, 0);
+	rcu_write_unlock(&bus->rcu);
+
+	return err ? -2 : 0;
+}
+
+void event_bus_publish_batch(event_bus_t *bus, const int *codes, size_t n) {
+	if(!(bus && codes) || n == 0) {
+		return;
+	}
+
+	unsigned token = rcu_read_lock(&bus->rcu);
+	publish_all_locked(bus, codes, n);
+	for(size_t i = 0; i < n; i++) {
+		publish_topic_locked(bus, codes[i], NULL);
+	}
+	rcu_read_unlock(&bus->rcu, token);
+}
+
+int event_bus_subscribe_topic(event_bus_t *bus, int topic, event_handler_t fn, void *ctx) {
+	if(!(bus && fn)) {
+		return -1;
+	}
+
+	event_sub_t s = { NULL, NULL, fn, ctx };
+	int err = 0;
+
+	rcu_write_lock(&bus->rcu);
+	event_topic_table_t *tab = atomic_load_explicit(&bus->topics, memory_order_relaxed);
+	event_topic_t *free_slot = NULL;
+	event_topic_t *t = tab ? topic_slot_locked(tab, topic, &free_slot) : NULL;
+
+	if(!t && bus->n_topics >= MAX_TOPICS) {
+		err = -1;
+	} else if(!t) {
+		// a new topic takes a tombstone, or a never-used slot while at
+		// most half the table is used; otherwise compact first
+		if(!free_slot || (!atomic_load_explicit(&free_slot->used, memory_order_relaxed) &&
+		                  tab->n_used >= MAX_TOPICS)) {
+			tab = table_rebuild(bus, tab);
+			if(!tab || topic_slot_locked(tab, topic, &free_slot)) {
+				err = -1;
+			}
+		}
+		if(!err) {
+			if(!atomic_load_explicit(&free_slot->used, memory_order_relaxed)) {
+				tab->n_used++;
+				atomic_store_explicit(&free_slot->used, 1, memory_order_release);
+			}
+			err = list_add(bus, &free_slot->subs, &s, topic);
+			bus->n_topics += !err;
+		}
+	} else {
+		err = list_add(bus, &t->subs, &s, topic);
+	}
+	rcu_write_unlock(&bus->rcu);
+
+	return err ? -2 : 0;
+}
+
+int event_bus_unsubscribe_topic(event_bus_t *bus, int topic, event_handler_t fn, void *ctx) {
+	if(!bus) {
+		return -1;
 	}
+
+	event_sub_t s = { NULL, NULL, fn, ctx };
+
+	int err = -1;
+
+	rcu_write_lock(&bus->rcu);
+	event_topic_table_t *tab = atomic_load_explicit(&bus->topics, memory_order_relaxed);
+	event_topic_t *free_slot;
+	event_topic_t *t = tab ? topic_slot_locked(tab, topic, &free_slot) : NULL;
+	if(t) {
+		err = list_remove(bus, &t->subs, &s);
+		// the last subscriber leaves a tombstone
+		bus->n_topics -= !err && !atomic_load_explicit(&t->subs, memory_order_relaxed);
+	}
+	rcu_write_unlock(&bus->rcu);
+
+	return err;
+}
+
+void event_bus_publish_topic(event_bus_t *bus, int topic, const void *payload) {
+	if(!bus) {
+		return;
+	}
+
+	unsigned token = rcu_read_lock(&bus->rcu);
+	publish_all_locked(bus, &topic, 1);
+	publish_topic_locked(bus, topic, payload);
+	rcu_read_unlock(&bus->rcu, token);
 }
@@ -0,0 +1,213 @@
+#include <stdint.h>
+#include "event_bus.h"
+
+#define RING_MASK	(EVENT_BUS_RING_SIZE - 1)
+
+_Static_assert((EVENT_BUS_RING_SIZE & RING_MASK) == 0, "EVENT_BUS_RING_SIZE must be a power of two");
+
+// Bounded MPMC ring (Vyukov): cell i is free for the producer at
+// position pos when seq == pos, and holds an event for the consumer at
+// pos when seq == pos + 1. Returns 0 on success, -1 if full.
+static int ring_push(event_bus_async_t *a, int code) {
+	size_t pos = atomic_load_explicit(&a->tail, memory_order_relaxed);
+	event_bus_cell_t *cell;
+
+	for(;;) {
+		cell = &a->ring[pos & RING_MASK];
+		size_t seq = atomic_load_explicit(&cell->seq, memory_order_acquire);
+		intptr_t dif = (intptr_t)seq - (intptr_t)pos;
+
+		if(dif == 0) {
+			if(atomic_compare_exchange_weak_explicit(&a->tail, &pos, pos + 1,
+			                                         memory_order_relaxed, memory_order_relaxed)) {
+				break;
+			}
+		} else if(dif < 0) {
+			return -1;
+		} else {
+			pos = atomic_load_explicit(&a->tail, memory_order_relaxed);
+		}
+	}
+
+	cell->code = code;
+	atomic_store_explicit(&cell->seq, pos + 1, memory_order_release);
+	return 0;
+}
+
+// Returns 0 and the oldest event in *code, or -1 if empty
+static int ring_pop(event_bus_async_t *a, int *code) {
+	size_t pos = atomic_load_explicit(&a->head, memory_order_relaxed);
+	event_bus_cell_t *cell;
+
+	for(;;) {
+		cell = &a->ring[pos & RING_MASK];
+		size_t seq = atomic_load_explicit(&cell->seq, memory_order_acquire);
+		intptr_t dif = (intptr_t)seq - (intptr_t)(pos + 1);
+
+		if(dif == 0) {
+			if(atomic_compare_exchange_weak_explicit(&a->head, &pos, pos + 1,
+			                                         memory_order_relaxed, memory_order_relaxed)) {
+				break;
+			}
+		} else if(dif < 0) {
+			return -1;
+		} else {
+			pos = atomic_load_explicit(&a->head, memory_order_relaxed);
+		}
+	}
+
+	*code = cell->code;
+	atomic_store_explicit(&cell->seq, pos + EVENT_BUS_RING_SIZE, memory_order_release);
+	return 0;
+}
+
+// Wakes one sleeper on cond if the counter says there is one. The fence
+// pairs with the one in the sleeper: either the sleeper's re-check sees
+// the ring change made before this call, or this load sees the sleeper.
+static void wake_one(event_bus_async_t *a, atomic_size_t *sleepers, pthread_cond_t *cond) {
+	atomic_thread_fence(memory_order_seq_cst);
+	if(atomic_load_explicit(sleepers, memory_order_relaxed)) {
+		pthread_mutex_lock(&a->lock);
+		pthread_cond_signal(cond);
+		pthread_mutex_unlock(&a->lock);
+	}
+}
+
+static void *dispatcher_main(void *arg) {
+	event_bus_async_t *a = arg;
+	int code;
+
+	for(;;) {
+		if(ring_pop(a, &code) == 0) {
+			if(a->policy == EVENT_BUS_BLOCK) {
+				wake_one(a, &a->blocked_publishers, &a->not_full);
+			}
+			event_bus_publish(a->bus, code);
+			continue;
+		}
+
+		// Empty: sleep until a publisher or event_bus_stop_async wakes us
+		pthread_mutex_lock(&a->lock);
+		atomic_fetch_add(&a->idle_dispatchers, 1);
+		atomic_thread_fence(memory_order_seq_cst);
+		int got = ring_pop(a, &code) == 0;
+		while(!got && !atomic_load(&a->stopping)) {
+			pthread_cond_wait(&a->not_empty, &a->lock);
+			got = ring_pop(a, &code) == 0;
+		}
+		atomic_fetch_sub(&a->idle_dispatchers, 1);
+		pthread_mutex_unlock(&a->lock);
+
+		if(!got) {
+			// stopping, and the ring was empty under the lock
+			return NULL;
+		}
+		if(a->policy == EVENT_BUS_BLOCK) {
+			wake_one(a, &a->blocked_publishers, &a->not_full);
+		}
+		event_bus_publish(a->bus, code);
+	}
+}
+
+int event_bus_start_async(event_bus_t *bus, event_bus_async_t *async,
+                          size_t n_threads, event_bus_policy_t policy) {
+	if(!(bus && async) || n_threads == 0 || n_threads > MAX_DISPATCHERS) {
+		return -1;
+	}
+
+	if(bus->async) {
+		return -2;
+	}
+
+	async->bus = bus;
+	async->policy = policy;
+	for(size_t i = 0; i < EVENT_BUS_RING_SIZE; i++) {
+		atomic_init(&async->ring[i].seq, i);
+	}
+	atomic_init(&async->head, 0);
+	atomic_init(&async->tail, 0);
+	atomic_init(&async->idle_dispatchers, 0);
+	atomic_init(&async->blocked_publishers, 0);
+	atomic_init(&async->stopping, 0);
+	atomic_init(&async->dropped, 0);
+	pthread_mutex_init(&async->lock, NULL);
+	pthread_cond_init(&async->not_empty, NULL);
+	pthread_cond_init(&async->not_full, NULL);
+
+	bus->async = async;
+	for(async->n_threads = 0; async->n_threads < n_threads; async->n_threads++) {
+		if(pthread_create(&async->threads[async->n_threads], NULL, dispatcher_main, async)) {
+			event_bus_stop_async(bus);
+			return -3;
+		}
+	}
+
+	return 0;
+}
+
+int event_bus_publish_async(event_bus_t *bus, int code) {
+	if(!(bus && bus->async)) {
+		return -1;
+	}
+
+	event_bus_async_t *a = bus->async;
+	int code_old;
+
+	while(ring_push(a, code) != 0) {
+		switch(a->policy) {
+		case EVENT_BUS_DROP_NEWEST:
+			atomic_fetch_add_explicit(&a->dropped, 1, memory_order_relaxed);
+			return -2;
+
+		case EVENT_BUS_DROP_OLDEST:
+			if(ring_pop(a, &code_old) == 0) {
+				atomic_fetch_add_explicit(&a->dropped, 1, memory_order_relaxed);
+			}
+			break;
+
+		case EVENT_BUS_BLOCK:
+			pthread_mutex_lock(&a->lock);
+			atomic_fetch_add(&a->blocked_publishers, 1);
+			atomic_thread_fence(memory_order_seq_cst);
+			while(ring_push(a, code) != 0) {
+				pthread_cond_wait(&a->not_full, &a->lock);
+			}
+			atomic_fetch_sub(&a->blocked_publishers, 1);
+			pthread_mutex_unlock(&a->lock);
+			wake_one(a, &a->idle_dispatchers, &a->not_empty);
+			return 0;
+		}
+	}
+
+	wake_one(a, &a->idle_dispatchers, &a->not_empty);
+	return 0;
+}
+
+size_t event_bus_dropped(const event_bus_t *bus) {
+	if(!(bus && bus->async)) {
+		return 0;
+	}
+	return atomic_load_explicit(&bus->async->dropped, memory_order_relaxed);
+}
+
+void event_bus_stop_async(event_bus_t *bus) {
+	if(!(bus && bus->async)) {
+		return;
+	}
+
+	event_bus_async_t *a = bus->async;
+
+	pthread_mutex_lock(&a->lock);
+	atomic_store(&a->stopping, 1);
+	pthread_cond_broadcast(&a->not_empty);
+	pthread_mutex_unlock(&a->lock);
+
+	for(size_t i = 0; i < a->n_threads; i++) {
+		pthread_join(a->threads[i], NULL);
+	}
+
+	pthread_cond_destroy(&a->not_full);
+	pthread_cond_destroy(&a->not_empty);
+	pthread_mutex_destroy(&a->lock);
+	bus->async = NULL;
+}
@@ -11,4 +11,6 @@ int main() {
 	printf("===== Begin Flow ====\n");
 	top_do_work(&bus);
 	printf("===== End Flow ====\n");
+
+	event_bus_destroy(&bus);
 }
@@ -0,0 +1,60 @@
+#ifndef RCU_H
+#define RCU_H
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stddef.h>
+
+// Minimal read-copy-update for subscriber lists.
+//
+// Readers bracket their use of a published pointer with rcu_read_lock /
+// rcu_read_unlock: two atomic counter updates, no lock, no waiting.
+// Writers serialise on rcu_write_lock, publish a replacement with an
+// atomic store and hand the old object to rcu_retire. Nothing waits for
+// readers: each rcu_write_unlock moves the grace period along if the
+// readers allow it and frees what has become unreachable. Retired objects
+// therefore outlive their last reader by a few writes; rcu_destroy frees
+// any left over.
+
+// Put this first in every object passed to rcu_retire
+typedef struct rcu_head {
+	struct rcu_head *next;
+	size_t           gp;	// grace period steps started when retired
+} rcu_head_t;
+
+typedef struct {
+	atomic_uint     idx;		// which readers[] counter new readers use
+	atomic_size_t   readers[2];
+	pthread_mutex_t lock;		// serialises writers; guards the rest
+
+	// A step flips idx, then completes once the counter new readers
+	// left has drained. Two steps started after an object was retired
+	// cover every reader that could have seen it.
+	size_t          started;
+	size_t          completed;
+	rcu_head_t     *retired;	// oldest first
+	rcu_head_t     *retired_tail;
+} rcu_t;
+
+void rcu_init(rcu_t *r);
+
+// Frees whatever is still retired; no reader or writer may be active
+void rcu_destroy(rcu_t *r);
+
+// Returns the token to pass to rcu_read_unlock. Load pointers published
+// under r after this call, with memory_order_seq_cst.
+unsigned rcu_read_lock(rcu_t *r);
+void rcu_read_unlock(rcu_t *r, unsigned token);
+
+void rcu_write_lock(rcu_t *r);
+
+// Queues obj, already unpublished, to be freed with free()
+void rcu_retire(rcu_t *r, rcu_head_t *obj);
+
+// Advances the grace period without waiting, releases the writer lock,
+// then frees the retired objects no reader can reach anymore. Also safe
+// inside a read section (a slot that connects or disconnects): that
+// reader only holds back the step it could be part of.
+void rcu_write_unlock(rcu_t *r);
+
+#endif // RCU_H
@@ -0,0 +1,95 @@
+#include <stdlib.h>
+#include "../include/rcu.h"
+
+void rcu_init(rcu_t *r) {
+	atomic_init(&r->idx, 0);
+	atomic_init(&r->readers[0], 0);
+	atomic_init(&r->readers[1], 0);
+	pthread_mutex_init(&r->lock, NULL);
+	r->started = 0;
+	r->completed = 0;
+	r->retired = NULL;
+	r->retired_tail = NULL;
+}
+
+static void free_list(rcu_head_t *p) {
+	while(p) {
+		rcu_head_t *next = p->next;
+		free(p);
+		p = next;
+	}
+}
+
+void rcu_destroy(rcu_t *r) {
+	free_list(r->retired);
+	r->retired = NULL;
+	r->retired_tail = NULL;
+	pthread_mutex_destroy(&r->lock);
+}
+
+unsigned rcu_read_lock(rcu_t *r) {
+	unsigned token = atomic_load_explicit(&r->idx, memory_order_relaxed) & 1;
+	atomic_fetch_add(&r->readers[token], 1);
+	return token;
+}
+
+void rcu_read_unlock(rcu_t *r, unsigned token) {
+	atomic_fetch_sub_explicit(&r->readers[token], 1, memory_order_release);
+}
+
+void rcu_write_lock(rcu_t *r) {
+	pthread_mutex_lock(&r->lock);
+}
+
+void rcu_retire(rcu_t *r, rcu_head_t *obj) {
+	obj->next = NULL;
+	obj->gp = r->started;
+	if(r->retired_tail) {
+		r->retired_tail->next = obj;
+	} else {
+		r->retired = obj;
+	}
+	r->retired_tail = obj;
+}
+
+// A reader that may hold an unpublished object counted itself before the
+// unpublishing store (all seq_cst), so its counter cannot read 0 until it
+// is done. A flip sends new readers to the other counter and lets the
+// old one drain; a reader that loaded idx just before a flip can still
+// land on the old counter, hence two steps, one per counter.
+static void advance(rcu_t *r) {
+	if(r->started == r->completed) {
+		if(!r->retired) {
+			return;
+		}
+		atomic_fetch_xor(&r->idx, 1);
+		r->started++;
+	}
+
+	unsigned old = (atomic_load(&r->idx) & 1) ^ 1;
+	if(atomic_load(&r->readers[old]) == 0) {
+		r->completed++;
+	}
+}
+
+void rcu_write_unlock(rcu_t *r) {
+	advance(r);
+
+	// detach what two completed steps have covered
+	rcu_head_t *done = NULL;
+	if(r->retired && r->retired->gp + 2 <= r->completed) {
+		rcu_head_t *last = r->retired;
+		while(last->next && last->next->gp + 2 <= r->completed) {
+			last = last->next;
+		}
+		done = r->retired;
+		r->retired = last->next;
+		if(!r->retired) {
+			r->retired_tail = NULL;
+		}
+		last->next = NULL;
+	}
+	pthread_mutex_unlock(&r->lock);
+
+	free_list(done);
+}
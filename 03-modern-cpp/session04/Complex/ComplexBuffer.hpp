@@ -0,0 +1,354 @@
+/**
+ * ComplexBuffer.hpp
+ *
+ *  Structure-of-arrays storage for dsp::Complex<T>: all real parts in one
+ *  array and all imaginary parts in another, so the kernels below load
+ *  full vector registers of like components instead of shuffling
+ *  interleaved (re, im) pairs.
+ */
+#ifndef COMPLEX_BUFFER_HPP_
+#define COMPLEX_BUFFER_HPP_
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "DspComplex.hpp"
+
+namespace dsp
+{
+
+namespace detail
+{
+
+// What a component is stored as: Q15 is kept as plain int16_t so the
+// kernels work on the integer type the vectoriser understands
+template <typename T>
+struct Lane
+{
+	using type = T;
+};
+
+template <>
+struct Lane<Q15>
+{
+	using type = std::int16_t;
+};
+
+template <typename T>
+using lane_t = typename Lane<T>::type;
+
+// Elements per block: a fixed trip count the vectoriser accepts at -O2,
+// and two 512-bit registers of each component
+template <typename T>
+constexpr std::size_t kLanes = 128 / sizeof(lane_t<T>);
+
+} // namespace detail
+
+template <typename T>
+class ComplexBuffer
+{
+public:
+	using value_type = Complex<T>;
+	using lane_type = detail::lane_t<T>;
+
+	ComplexBuffer() = default;
+	explicit ComplexBuffer(std::size_t n) : re_(n), im_(n) {}
+
+	std::size_t size() const { return re_.size(); }
+	bool empty() const { return re_.empty(); }
+
+	void resize(std::size_t n)
+	{
+		re_.resize(n);
+		im_.resize(n);
+	}
+
+	void reserve(std::size_t n)
+	{
+		re_.reserve(n);
+		im_.reserve(n);
+	}
+
+	void clear()
+	{
+		re_.clear();
+		im_.clear();
+	}
+
+	void push_back(const Complex<T> &c)
+	{
+		re_.push_back(toLane(c.real()));
+		im_.push_back(toLane(c.imag()));
+	}
+
+	// Element i, assembled from the two arrays
+	Complex<T> operator[](std::size_t i) const
+	{
+		return Complex<T>(fromLane(re_[i]), fromLane(im_[i]));
+	}
+
+	void set(std::size_t i, const Complex<T> &c)
+	{
+		re_[i] = toLane(c.real());
+		im_[i] = toLane(c.imag());
+	}
+
+	// The component arrays, for kernels and I/O
+	lane_type *real() { return re_.data(); }
+	lane_type *imag() { return im_.data(); }
+	const lane_type *real() const { return re_.data(); }
+	const lane_type *imag() const { return im_.data(); }
+
+private:
+	std::vector<lane_type> re_;
+	std::vector<lane_type> im_;
+
+	static lane_type toLane(T v)
+	{
+		if constexpr (std::is_same_v<T, Q15>)
+			return v.raw;
+		else
+			return v;
+	}
+
+	static T fromLane(lane_type v)
+	{
+		if constexpr (std::is_same_v<T, Q15>)
+			return Q15::fromRaw(v);
+		else
+			return v;
+	}
+};
+
+// Element-wise kernels. Each runs in blocks of kLanes elements; a block
+// has a constant trip count, which GCC vectorises at -O2 (a loop over n
+// needs -O3), and is marked ivdep because element j only reads inputs at
+// j, so out may be the same buffer as an input. The block loop counts j
+// from 0: GCC 12 leaves a double block counted from i to i + K scalar.
+// magnitude() vectorises only with -fno-math-errno, since std::sqrt may
+// otherwise set errno.
+//
+// Against a loop over Complex<T> (bench/complex_bench.cpp, SSE2, -O2):
+// Q15 add about x4.5, multiply x2.5; float add x2, multiply x2.5; double
+// multiply x1.2. Double add gains nothing (x0.6 to x1): a Complex<double>
+// already fills one SSE2 register, so the loop is one addpd per element.
+//
+// Q15 results round and saturate exactly like the scalar Complex<Q15>
+// operators; conjMultiply conjugates exactly, so it only differs from
+// a * b.conj() when an imaginary part of b is -1 (whose Q15 negation
+// saturates).
+//
+// The binary kernels throw std::invalid_argument if the input sizes
+// differ; out is resized to match.
+
+namespace detail
+{
+
+inline std::int16_t sat16(std::int32_t v)
+{
+	return static_cast<std::int16_t>(v > Q15::kMax ? Q15::kMax : v < Q15::kMin ? Q15::kMin : v);
+}
+
+// The Q15 kernels below stay in 16-bit lanes: SSE2 has no instruction to
+// saturate 32-bit lanes back to 16 bits, and the shuffles GCC emits for
+// sat16() instead cost more than the block saves.
+
+// sat16(a + b): the wrapped sum overflowed if its sign differs from both
+// operands', and then saturates towards a's sign
+inline std::int16_t addSat16(std::int16_t a, std::int16_t b)
+{
+	auto s = static_cast<std::int16_t>(static_cast<std::uint16_t>(a) + static_cast<std::uint16_t>(b));
+	auto overflow = static_cast<std::int16_t>((a ^ s) & (b ^ s));
+	return overflow < 0 ? static_cast<std::int16_t>((a >> 15) ^ Q15::kMax) : s;
+}
+
+// sat16((a b + c d + 2^14) >> 15), or a b - c d with Subtract: the Q15
+// rounding of the exact sum, as Complex<Q15>::operator* computes it in
+// 64 bits. Each product is split into its high and low 16 bits (pmulhw
+// and pmullw) and the sum is carried like a two-digit number in base
+// 2^16. hi then lies in [-2^15, 2^15], where only a b + c d = 2^31 (all
+// four -1.0) reaches 2^15 and wraps to -2^15; a difference stays above
+// that. The result fits in int16 exactly when hi is in [-2^14, 2^14).
+template <bool Subtract>
+inline std::int16_t roundQ15Dot(std::int16_t a, std::int16_t b, std::int16_t c, std::int16_t d)
+{
+	using U = std::uint16_t;
+	auto ph = static_cast<std::int16_t>((a * b) >> 16);
+	auto qh = static_cast<std::int16_t>((c * d) >> 16);
+	auto pl = static_cast<U>(U(a) * U(b));
+	auto ql = static_cast<U>(U(c) * U(d));
+
+	U lo;
+	std::int16_t hi;
+	if constexpr (Subtract)
+	{
+		lo = static_cast<U>(pl - ql);
+		hi = static_cast<std::int16_t>(ph - qh - (pl < ql));
+	}
+	else
+	{
+		lo = static_cast<U>(pl + ql);
+		hi = static_cast<std::int16_t>(ph + qh + (lo < pl));
+	}
+	auto rounded = static_cast<U>(lo + (1 << 14));
+	hi = static_cast<std::int16_t>(hi + (rounded < lo));
+
+	bool wrapped = !Subtract && hi == Q15::kMin;
+	if (hi >= (1 << 14) || wrapped)
+		return Q15::kMax;
+	if (hi < -(1 << 14))
+		return Q15::kMin;
+	return static_cast<std::int16_t>(hi * 2 + (rounded >> 15));
+}
+
+// One element of each kernel, shared by the block body and the tail
+
+template <typename L>
+inline L addOne(L a, L b)
+{
+	if constexpr (std::is_same_v<L, std::int16_t>)
+		return addSat16(a, b);
+	else
+		return a + b;
+}
+
+// (ar + i ai)(br + i bi), or with conjugate, (ar + i ai)(br - i bi)
+template <bool Conjugate, typename L>
+inline void mulOne(L ar, L ai, L br, L bi, L &outR, L &outI)
+{
+	if constexpr (std::is_same_v<L, std::int16_t>)
+	{
+		// conjugating flips which sums are differences, so -bi is
+		// never formed (it would saturate for -1.0)
+		outR = roundQ15Dot<!Conjugate>(ar, br, ai, bi);
+		outI = Conjugate ? roundQ15Dot<true>(ai, br, ar, bi) : roundQ15Dot<false>(ar, bi, ai, br);
+	}
+	else
+	{
+		outR = Conjugate ? ar * br + ai * bi : ar * br - ai * bi;
+		outI = Conjugate ? ai * br - ar * bi : ar * bi + ai * br;
+	}
+}
+
+template <typename L>
+inline L magnitudeOne(L re, L im)
+{
+	if constexpr (std::is_same_v<L, std::int16_t>)
+	{
+		// as Complex<Q15>::abs: the squares are summed in float, which
+		// is exact enough for a 16-bit result and cannot overflow
+		float n = static_cast<float>(re * re) + static_cast<float>(im * im);
+		return sat16(static_cast<std::int32_t>(std::sqrt(n) + 0.5f));
+	}
+	else
+	{
+		return std::sqrt(re * re + im * im);
+	}
+}
+
+template <typename T>
+void checkSizes(const ComplexBuffer<T> &a, const ComplexBuffer<T> &b)
+{
+	if (a.size() != b.size())
+		throw std::invalid_argument("ComplexBuffer sizes differ");
+}
+
+// One component array at a time: add() runs this over the real parts,
+// then the imaginary parts, so a block streams three arrays instead of six
+template <typename L, typename Op>
+void componentKernel(const L *a, const L *b, L *out, std::size_t n, Op op)
+{
+	constexpr std::size_t K = 128 / sizeof(L); // kLanes, by lane type
+
+	std::size_t i = 0;
+	for (; i + K <= n; i += K)
+	{
+#pragma GCC ivdep
+		for (std::size_t j = 0; j < K; ++j)
+			out[i + j] = op(a[i + j], b[i + j]);
+	}
+	for (; i < n; ++i)
+		out[i] = op(a[i], b[i]);
+}
+
+template <typename T, typename Op>
+void binaryKernel(const ComplexBuffer<T> &a, const ComplexBuffer<T> &b, ComplexBuffer<T> &out, Op op)
+{
+	using L = lane_t<T>;
+	constexpr std::size_t K = kLanes<T>;
+
+	checkSizes(a, b);
+	const std::size_t n = a.size();
+	out.resize(n);
+
+	const L *ar = a.real(), *ai = a.imag();
+	const L *br = b.real(), *bi = b.imag();
+	L *outR = out.real(), *outI = out.imag();
+
+	std::size_t i = 0;
+	for (; i + K <= n; i += K)
+	{
+#pragma GCC ivdep
+		for (std::size_t j = 0; j < K; ++j)
+			op(ar[i + j], ai[i + j], br[i + j], bi[i + j], outR[i + j], outI[i + j]);
+	}
+	for (; i < n; ++i)
+		op(ar[i], ai[i], br[i], bi[i], outR[i], outI[i]);
+}
+
+} // namespace detail
+
+// out[i] = a[i] + b[i]
+template <typename T>
+void add(const ComplexBuffer<T> &a, const ComplexBuffer<T> &b, ComplexBuffer<T> &out)
+{
+	detail::checkSizes(a, b);
+	out.resize(a.size());
+	auto op = [](auto x, auto y) { return detail::addOne(x, y); };
+	detail::componentKernel(a.real(), b.real(), out.real(), a.size(), op);
+	detail::componentKernel(a.imag(), b.imag(), out.imag(), a.size(), op);
+}
+
+// out[i] = a[i] * b[i]
+template <typename T>
+void multiply(const ComplexBuffer<T> &a, const ComplexBuffer<T> &b, ComplexBuffer<T> &out)
+{
+	detail::binaryKernel(a, b, out, [](auto &&...v) { detail::mulOne<false>(v...); });
+}
+
+// out[i] = a[i] * conj(b[i]), the correlation / matched-filter product
+template <typename T>
+void conjMultiply(const ComplexBuffer<T> &a, const ComplexBuffer<T> &b, ComplexBuffer<T> &out)
+{
+	detail::binaryKernel(a, b, out, [](auto &&...v) { detail::mulOne<true>(v...); });
+}
+
+// out[i] = |a[i]| (for Q15, in raw units); out is resized to a.size()
+template <typename T>
+void magnitude(const ComplexBuffer<T> &a, std::vector<detail::lane_t<T>> &out)
+{
+	using L = detail::lane_t<T>;
+	constexpr std::size_t K = detail::kLanes<T>;
+
+	const std::size_t n = a.size();
+	out.resize(n);
+	const L *ar = a.real(), *ai = a.imag();
+	L *o = out.data();
+
+	std::size_t i = 0;
+	for (; i + K <= n; i += K)
+	{
+#pragma GCC ivdep
+		for (std::size_t j = 0; j < K; ++j)
+			o[i + j] = detail::magnitudeOne(ar[i + j], ai[i + j]);
+	}
+	for (; i < n; ++i)
+		o[i] = detail::magnitudeOne(ar[i], ai[i]);
+}
+
+} // namespace dsp
+
+#endif /* COMPLEX_BUFFER_HPP_ */
@@ -0,0 +1,211 @@
+/**
+ * DspComplex.hpp
+ *
+ *  Complex<T> for signal processing, over float, double or Q15 (16-bit
+ *  fixed point). Unlike the teaching Complex class it has value
+ *  semantics only: no instance counter, no console output, const
+ *  operands.
+ */
+#ifndef DSP_COMPLEX_HPP_
+#define DSP_COMPLEX_HPP_
+
+#include <cmath>
+#include <cstdint>
+#include <ostream>
+#include <type_traits>
+
+namespace dsp
+{
+
+// Q15 fixed point: a value in [-1, 1) stored as raw / 32768 in an
+// int16_t. Arithmetic rounds to nearest and saturates instead of
+// wrapping, as DSP instruction sets do.
+struct Q15
+{
+	std::int16_t raw = 0;
+
+	static constexpr std::int32_t kOne = 1 << 15;
+	static constexpr std::int32_t kMax = 32767;
+	static constexpr std::int32_t kMin = -32768;
+
+	constexpr Q15() = default;
+
+	// Clamps an int32 to the int16 range
+	static constexpr Q15 saturate(std::int32_t v)
+	{
+		Q15 q;
+		q.raw = static_cast<std::int16_t>(v > kMax ? kMax : v < kMin ? kMin : v);
+		return q;
+	}
+
+	static constexpr Q15 fromRaw(std::int16_t r)
+	{
+		Q15 q;
+		q.raw = r;
+		return q;
+	}
+
+	// Nearest Q15 value to f, saturated to [-1, 1 - 2^-15]
+	static Q15 fromFloat(float f)
+	{
+		return saturate(static_cast<std::int32_t>(std::lround(f * kOne)));
+	}
+
+	constexpr float toFloat() const
+	{
+		return raw / static_cast<float>(kOne);
+	}
+
+	friend constexpr Q15 operator+(Q15 a, Q15 b) { return saturate(a.raw + b.raw); }
+	friend constexpr Q15 operator-(Q15 a, Q15 b) { return saturate(a.raw - b.raw); }
+	friend constexpr Q15 operator-(Q15 a) { return saturate(-a.raw); }
+
+	// (a * b + 2^14) >> 15; only -1 * -1 needs the saturation
+	friend constexpr Q15 operator*(Q15 a, Q15 b)
+	{
+		return saturate((a.raw * b.raw + (1 << 14)) >> 15);
+	}
+
+	friend constexpr bool operator==(Q15 a, Q15 b) { return a.raw == b.raw; }
+	friend constexpr bool operator!=(Q15 a, Q15 b) { return a.raw != b.raw; }
+};
+
+template <typename T>
+class Complex
+{
+public:
+	constexpr Complex(T re = T(), T im = T()) : re_(re), im_(im) {}
+
+	constexpr T real() const { return re_; }
+	constexpr T imag() const { return im_; }
+
+	constexpr Complex operator+(const Complex &o) const;
+	constexpr Complex operator-(const Complex &o) const;
+	constexpr Complex operator*(const Complex &o) const;
+	constexpr Complex operator-() const;
+
+	constexpr Complex &operator+=(const Complex &o);
+	constexpr Complex &operator-=(const Complex &o);
+	constexpr Complex &operator*=(const Complex &o);
+
+	constexpr bool operator==(const Complex &o) const;
+	constexpr bool operator!=(const Complex &o) const;
+
+	// Complex conjugate
+	constexpr Complex conj() const;
+
+	// |z|^2 (for Q15: in raw units squared, as uint32_t)
+	constexpr auto norm() const;
+
+	// |z| (for Q15: saturated to the largest Q15 value)
+	T abs() const;
+
+private:
+	T re_;
+	T im_;
+};
+
+template <typename T>
+constexpr Complex<T> Complex<T>::operator+(const Complex &o) const
+{
+	return Complex(re_ + o.re_, im_ + o.im_);
+}
+
+template <typename T>
+constexpr Complex<T> Complex<T>::operator-(const Complex &o) const
+{
+	return Complex(re_ - o.re_, im_ - o.im_);
+}
+
+template <>
+constexpr Complex<Q15> Complex<Q15>::operator*(const Complex &o) const
+{
+	// sum the exact products, then round once; the sum is kept in int64
+	// because (-1)(-1) - (-1)(1) = 2^31 does not fit int32
+	std::int64_t re = std::int64_t(re_.raw * o.re_.raw) - im_.raw * o.im_.raw;
+	std::int64_t im = std::int64_t(re_.raw * o.im_.raw) + im_.raw * o.re_.raw;
+	return Complex(Q15::saturate(static_cast<std::int32_t>((re + (1 << 14)) >> 15)),
+	               Q15::saturate(static_cast<std::int32_t>((im + (1 << 14)) >> 15)));
+}
+
+template <typename T>
+constexpr Complex<T> Complex<T>::operator*(const Complex &o) const
+{
+	return Complex(re_ * o.re_ - im_ * o.im_, re_ * o.im_ + im_ * o.re_);
+}
+
+template <typename T>
+constexpr Complex<T> Complex<T>::operator-() const
+{
+	return Complex(-re_, -im_);
+}
+
+template <typename T>
+constexpr Complex<T> &Complex<T>::operator+=(const Complex &o)
+{
+	return *this = *this + o;
+}
+
+template <typename T>
+constexpr Complex<T> &Complex<T>::operator-=(const Complex &o)
+{
+	return *this = *this - o;
+}
+
+template <typename T>
+constexpr Complex<T> &Complex<T>::operator*=(const Complex &o)
+{
+	return *this = *this * o;
+}
+
+template <typename T>
+constexpr bool Complex<T>::operator==(const Complex &o) const
+{
+	return re_ == o.re_ && im_ == o.im_;
+}
+
+template <typename T>
+constexpr bool Complex<T>::operator!=(const Complex &o) const
+{
+	return !(*this == o);
+}
+
+template <typename T>
+constexpr Complex<T> Complex<T>::conj() const
+{
+	return Complex(re_, -im_);
+}
+
+template <typename T>
+constexpr auto Complex<T>::norm() const
+{
+	if constexpr (std::is_same_v<T, Q15>)
+		return static_cast<std::uint32_t>(re_.raw * re_.raw) + static_cast<std::uint32_t>(im_.raw * im_.raw);
+	else
+		return re_ * re_ + im_ * im_;
+}
+
+template <typename T>
+T Complex<T>::abs() const
+{
+	if constexpr (std::is_same_v<T, Q15>)
+	{
+		float n = static_cast<float>(re_.raw * re_.raw) + static_cast<float>(im_.raw * im_.raw);
+		return Q15::saturate(static_cast<std::int32_t>(std::sqrt(n) + 0.5f));
+	}
+	else
+		return std::sqrt(norm());
+}
+
+template <typename T>
+std::ostream &operator<<(std::ostream &out, const Complex<T> &c)
+{
+	if constexpr (std::is_same_v<T, Q15>)
+		return out << c.real().toFloat() << " + " << c.imag().toFloat() << "i";
+	else
+		return out << c.real() << " + " << c.imag() << "i";
+}
+
+} // namespace dsp
+
+#endif /* DSP_COMPLEX_HPP_ */
@@ -0,0 +1,437 @@
+/**
+ * Fft.hpp
+ *
+ *  In-place FFT and inverse FFT over ComplexBuffer<float> and
+ *  ComplexBuffer<double>, for any size: the size is factored into radix
+ *  4, 2, 3 and 5 butterflies, with a generic O(p^2) butterfly for any
+ *  other prime factor p (so a large prime size degrades to a plain DFT).
+ *
+ *  An FftPlan holds everything that depends only on the size: the
+ *  factorisation, the twiddle factors of every stage and the cycles of
+ *  the input permutation. It is immutable once built, so one plan may
+ *  transform any number of buffers, from any number of threads.
+ *  FftPlanner builds each size once and hands the same plan back on
+ *  later calls.
+ *
+ *  Transforms are unnormalised forward, e^(-2 pi i jk/n), and scaled by
+ *  1/n inverse, so inverse(forward(x)) == x.
+ */
+#ifndef FFT_HPP_
+#define FFT_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "ComplexBuffer.hpp"
+#include "DspComplex.hpp"
+
+namespace dsp
+{
+
+namespace detail
+{
+
+// Stages whose span fits in this many elements run one block at a time
+// (all such stages over the first block, then the next block), so a
+// large transform streams through memory once for them instead of once
+// per stage. 4096 SoA elements of double are 64 KiB.
+constexpr std::size_t kFftBlockElements = 4096;
+
+template <typename T>
+constexpr Complex<T> mulI(const Complex<T> &z)
+{
+	return Complex<T>(-z.imag(), z.real());
+}
+
+template <typename T>
+constexpr Complex<T> scale(const Complex<T> &z, T s)
+{
+	return Complex<T>(z.real() * s, z.imag() * s);
+}
+
+} // namespace detail
+
+template <typename T>
+class FftPlan
+{
+	static_assert(std::is_floating_point_v<T>, "FftPlan needs float or double");
+
+public:
+	// throws std::invalid_argument if n is 0
+	explicit FftPlan(std::size_t n);
+
+	std::size_t size() const { return n_; }
+
+	// Radices of the stages, in the order they run
+	std::vector<std::size_t> factors() const;
+
+	// Transform x in place; throw std::invalid_argument if x.size() is
+	// not size()
+	void forward(ComplexBuffer<T> &x) const;
+	void inverse(ComplexBuffer<T> &x) const;
+
+private:
+	struct Stage
+	{
+		std::size_t radix;
+		std::size_t span;      // elements combined by one butterfly group
+		std::size_t twiddles;  // offset of this stage in twiddles_
+		std::size_t roots;     // offset of the radix roots in roots_
+	};
+
+	std::size_t n_;
+	std::vector<Stage> stages_;
+	std::size_t blocked_ = 0;  // stages_[0, blocked_) run per block
+	std::size_t blockSpan_ = 1;
+	std::vector<Complex<T>> twiddles_;
+	std::vector<Complex<T>> roots_;
+	std::vector<std::size_t> source_;  // element p is taken from source_[p]
+	std::vector<std::size_t> cycles_;  // one index per permutation cycle
+	std::size_t maxRadix_ = 1;
+
+	template <bool Inverse>
+	void transform(ComplexBuffer<T> &x) const;
+
+	void permute(T *re, T *im) const;
+
+	template <bool Inverse>
+	void runStages(T *re, T *im, std::size_t first, std::size_t last,
+	               std::size_t begin, std::size_t end, Complex<T> *scratch) const;
+
+	template <bool Inverse>
+	void butterflies(T *re, T *im, const Stage &s, std::size_t base, Complex<T> *scratch) const;
+};
+
+template <typename T>
+FftPlan<T>::FftPlan(std::size_t n) : n_(n)
+{
+	if (n == 0)
+		throw std::invalid_argument("FftPlan size must be positive");
+
+	// 4s first: they are the cheapest butterflies per element
+	std::vector<std::size_t> radices;
+	std::size_t rest = n;
+	while (rest % 4 == 0)
+	{
+		radices.push_back(4);
+		rest /= 4;
+	}
+	for (std::size_t p = 2; p * p <= rest; ++p)
+	{
+		while (rest % p == 0)
+		{
+			radices.push_back(p);
+			rest /= p;
+		}
+	}
+	if (rest > 1)
+		radices.push_back(rest);
+
+	const double pi = std::acos(-1.0);
+	std::map<std::size_t, std::size_t> rootOffsets;
+	std::size_t span = 1;
+	for (std::size_t r : radices)
+	{
+		std::size_t m = span;
+		span *= r;
+		Stage s{r, span, twiddles_.size(), 0};
+
+		// w_span^(jk) for k < m, j = 1 .. r-1, in the order they are read
+		for (std::size_t k = 0; k < m; ++k)
+			for (std::size_t j = 1; j < r; ++j)
+			{
+				double a = -2 * pi * double(j * k) / double(span);
+				twiddles_.emplace_back(T(std::cos(a)), T(std::sin(a)));
+			}
+
+		if (r > 5)
+		{
+			auto it = rootOffsets.find(r);
+			if (it == rootOffsets.end())
+			{
+				it = rootOffsets.emplace(r, roots_.size()).first;
+				for (std::size_t t = 0; t < r; ++t)
+				{
+					double a = -2 * pi * double(t) / double(r);
+					roots_.emplace_back(T(std::cos(a)), T(std::sin(a)));
+				}
+			}
+			s.roots = it->second;
+		}
+		maxRadix_ = std::max(maxRadix_, r);
+		stages_.push_back(s);
+
+		if (span <= detail::kFftBlockElements)
+		{
+			blocked_ = stages_.size();
+			blockSpan_ = span;
+		}
+	}
+
+	// Decimation in time wants element p of the input at the position
+	// whose mixed-radix digits are those of p reversed: the last stage
+	// splits the input into radix interleaved subsequences, the stage
+	// before that splits each of those, and so on
+	source_.resize(n);
+	for (std::size_t p = 0; p < n; ++p)
+	{
+		std::size_t idx = 0, stride = 1, rem = p, size = n;
+		for (std::size_t s = stages_.size(); s-- > 0;)
+		{
+			size /= stages_[s].radix;
+			idx += rem / size * stride;
+			rem %= size;
+			stride *= stages_[s].radix;
+		}
+		source_[p] = idx;
+	}
+
+	// Record one index per cycle of length > 1 so permute() can follow
+	// the cycles in place
+	std::vector<bool> seen(n);
+	for (std::size_t p = 0; p < n; ++p)
+	{
+		if (seen[p] || source_[p] == p)
+			continue;
+		cycles_.push_back(p);
+		for (std::size_t q = p; !seen[q]; q = source_[q])
+			seen[q] = true;
+	}
+}
+
+template <typename T>
+std::vector<std::size_t> FftPlan<T>::factors() const
+{
+	std::vector<std::size_t> f;
+	for (const Stage &s : stages_)
+		f.push_back(s.radix);
+	return f;
+}
+
+template <typename T>
+void FftPlan<T>::forward(ComplexBuffer<T> &x) const
+{
+	transform<false>(x);
+}
+
+template <typename T>
+void FftPlan<T>::inverse(ComplexBuffer<T> &x) const
+{
+	transform<true>(x);
+
+	const T s = T(1) / T(n_);
+	T *re = x.real(), *im = x.imag();
+	for (std::size_t i = 0; i < n_; ++i)
+	{
+		re[i] *= s;
+		im[i] *= s;
+	}
+}
+
+template <typename T>
+template <bool Inverse>
+void FftPlan<T>::transform(ComplexBuffer<T> &x) const
+{
+	if (x.size() != n_)
+		throw std::invalid_argument("buffer size does not match the FftPlan");
+
+	T *re = x.real(), *im = x.imag();
+	permute(re, im);
+
+	// only the generic butterfly needs room for its inputs
+	std::vector<Complex<T>> scratch(maxRadix_ > 5 ? maxRadix_ : 0);
+
+	for (std::size_t b = 0; b < n_; b += blockSpan_)
+		runStages<Inverse>(re, im, 0, blocked_, b, b + blockSpan_, scratch.data());
+	runStages<Inverse>(re, im, blocked_, stages_.size(), 0, n_, scratch.data());
+}
+
+template <typename T>
+void FftPlan<T>::permute(T *re, T *im) const
+{
+	for (std::size_t c : cycles_)
+	{
+		T r = re[c], i = im[c];
+		std::size_t p = c;
+		for (std::size_t q = source_[p]; q != c; p = q, q = source_[q])
+		{
+			re[p] = re[q];
+			im[p] = im[q];
+		}
+		re[p] = r;
+		im[p] = i;
+	}
+}
+
+template <typename T>
+template <bool Inverse>
+void FftPlan<T>::runStages(T *re, T *im, std::size_t first, std::size_t last,
+                           std::size_t begin, std::size_t end, Complex<T> *scratch) const
+{
+	for (std::size_t s = first; s < last; ++s)
+		for (std::size_t base = begin; base < end; base += stages_[s].span)
+			butterflies<Inverse>(re, im, stages_[s], base, scratch);
+}
+
+// One group of a stage: the r sub-transforms of length m = span / r at
+// base, base + m, ... become one transform of length span. Element k of
+// sub-transform j is twiddled by w_span^(jk), then each k takes an
+// r-point DFT across the sub-transforms.
+template <typename T>
+template <bool Inverse>
+void FftPlan<T>::butterflies(T *re, T *im, const Stage &s, std::size_t base, Complex<T> *scratch) const
+{
+	using C = Complex<T>;
+	const std::size_t r = s.radix;
+	const std::size_t m = s.span / r;
+	const C *tw = twiddles_.data() + s.twiddles;
+
+	auto load = [&](std::size_t i) { return C(re[i], im[i]); };
+	auto store = [&](std::size_t i, const C &z) {
+		re[i] = z.real();
+		im[i] = z.imag();
+	};
+	auto twiddle = [&](const C &z, const C &w) { return z * (Inverse ? w.conj() : w); };
+	// multiplies by -i forward and by +i inverse
+	auto rot = [](const C &z) { return Inverse ? detail::mulI(z) : -detail::mulI(z); };
+
+	switch (r)
+	{
+	case 2:
+		for (std::size_t k = 0; k < m; ++k, tw += 1)
+		{
+			std::size_t i = base + k;
+			C a = load(i);
+			C b = twiddle(load(i + m), tw[0]);
+			store(i, a + b);
+			store(i + m, a - b);
+		}
+		break;
+
+	case 3:
+	{
+		const T h = T(0.8660254037844386);  // sin(2 pi / 3)
+		for (std::size_t k = 0; k < m; ++k, tw += 2)
+		{
+			std::size_t i = base + k;
+			C a = load(i);
+			C b = twiddle(load(i + m), tw[0]);
+			C c = twiddle(load(i + 2 * m), tw[1]);
+			C sum = b + c;
+			C mid = a - detail::scale(sum, T(0.5));
+			C d = rot(detail::scale(b - c, h));
+			store(i, a + sum);
+			store(i + m, mid + d);
+			store(i + 2 * m, mid - d);
+		}
+		break;
+	}
+
+	case 4:
+		for (std::size_t k = 0; k < m; ++k, tw += 3)
+		{
+			std::size_t i = base + k;
+			C a = load(i);
+			C b = twiddle(load(i + m), tw[0]);
+			C c = twiddle(load(i + 2 * m), tw[1]);
+			C d = twiddle(load(i + 3 * m), tw[2]);
+			C ac = a + c, amc = a - c;
+			C bd = b + d, bmd = rot(b - d);
+			store(i, ac + bd);
+			store(i + m, amc + bmd);
+			store(i + 2 * m, ac - bd);
+			store(i + 3 * m, amc - bmd);
+		}
+		break;
+
+	case 5:
+	{
+		const T c1 = T(0.30901699437494745);   // cos(2 pi / 5)
+		const T c2 = T(-0.8090169943749473);   // cos(4 pi / 5)
+		const T s1 = T(0.9510565162951535);    // sin(2 pi / 5)
+		const T s2 = T(0.5877852522924732);    // sin(4 pi / 5)
+		for (std::size_t k = 0; k < m; ++k, tw += 4)
+		{
+			std::size_t i = base + k;
+			C a = load(i);
+			C b = twiddle(load(i + m), tw[0]);
+			C c = twiddle(load(i + 2 * m), tw[1]);
+			C d = twiddle(load(i + 3 * m), tw[2]);
+			C e = twiddle(load(i + 4 * m), tw[3]);
+			C be = b + e, cd = c + d, bme = b - e, cmd = c - d;
+			C m1 = a + detail::scale(be, c1) + detail::scale(cd, c2);
+			C m2 = a + detail::scale(be, c2) + detail::scale(cd, c1);
+			C r1 = rot(detail::scale(bme, s1) + detail::scale(cmd, s2));
+			C r2 = rot(detail::scale(bme, s2) - detail::scale(cmd, s1));
+			store(i, a + be + cd);
+			store(i + m, m1 + r1);
+			store(i + 2 * m, m2 + r2);
+			store(i + 3 * m, m2 - r2);
+			store(i + 4 * m, m1 - r1);
+		}
+		break;
+	}
+
+	default:
+	{
+		const C *root = roots_.data() + s.roots;
+		for (std::size_t k = 0; k < m; ++k, tw += r - 1)
+		{
+			std::size_t i = base + k;
+			scratch[0] = load(i);
+			for (std::size_t j = 1; j < r; ++j)
+				scratch[j] = twiddle(load(i + j * m), tw[j - 1]);
+			for (std::size_t q = 0; q < r; ++q)
+			{
+				C sum = scratch[0];
+				// t = j * q mod r
+				for (std::size_t j = 1, t = q; j < r; ++j, t = t + q >= r ? t + q - r : t + q)
+					sum += twiddle(scratch[j], root[t]);
+				store(i + q * m, sum);
+			}
+		}
+		break;
+	}
+	}
+}
+
+// Builds plans on first use and returns the same plan for a size after
+// that. Plans live as long as the planner; plan() is thread-safe.
+template <typename T>
+class FftPlanner
+{
+public:
+	const FftPlan<T> &plan(std::size_t n)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		auto it = plans_.find(n);
+		if (it == plans_.end())
+			it = plans_.emplace(n, std::make_unique<FftPlan<T>>(n)).first;
+		return *it->second;
+	}
+
+	void forward(ComplexBuffer<T> &x) { plan(x.size()).forward(x); }
+	void inverse(ComplexBuffer<T> &x) { plan(x.size()).inverse(x); }
+
+	// Number of plans built so far
+	std::size_t size() const
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		return plans_.size();
+	}
+
+private:
+	mutable std::mutex mutex_;
+	std::map<std::size_t, std::unique_ptr<FftPlan<T>>> plans_;
+};
+
+} // namespace dsp
+
+#endif /* FFT_HPP_ */
@@ -0,0 +1,182 @@
+/**
+ * fft_test.cpp
+ *
+ *  Checks FftPlan against a naive O(n^2) DFT over power-of-two,
+ *  mixed-radix and prime sizes, including sizes past the cache block,
+ *  plus round trips, known transforms and the planner's plan reuse.
+ *
+ *    g++ -std=c++17 -O2 -I. fft_test.cpp -o fft_test && ./fft_test
+ */
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+#include "Fft.hpp"
+
+using dsp::Complex;
+using dsp::ComplexBuffer;
+
+static int failures = 0;
+
+static void check(bool ok, const char *what, std::size_t n, double err)
+{
+	if (!ok)
+	{
+		std::printf("[FAIL] %s, n = %zu (error %g)\n", what, n, err);
+		++failures;
+	}
+}
+
+// X[k] = sum_j x[j] e^(-2 pi i jk/n), with the roots and the sums in
+// long double
+static std::vector<Complex<double>> naiveDft(const std::vector<Complex<double>> &x)
+{
+	const std::size_t n = x.size();
+	const long double pi = std::acos(-1.0L);
+	std::vector<long double> c(n), s(n);
+	for (std::size_t t = 0; t < n; ++t)
+	{
+		c[t] = std::cos(-2 * pi * t / n);
+		s[t] = std::sin(-2 * pi * t / n);
+	}
+
+	std::vector<Complex<double>> out(n);
+	for (std::size_t k = 0; k < n; ++k)
+	{
+		long double re = 0, im = 0;
+		for (std::size_t j = 0, t = 0; j < n; ++j, t = (t + k) % n)
+		{
+			re += x[j].real() * c[t] - x[j].imag() * s[t];
+			im += x[j].real() * s[t] + x[j].imag() * c[t];
+		}
+		out[k] = Complex<double>(double(re), double(im));
+	}
+	return out;
+}
+
+// Largest component error, relative to the largest component of ref
+template <typename T>
+static double maxError(const ComplexBuffer<T> &x, const std::vector<Complex<double>> &ref)
+{
+	double err = 0, scale = 1e-30;
+	for (std::size_t i = 0; i < ref.size(); ++i)
+	{
+		err = std::max(err, std::fabs(double(x[i].real()) - ref[i].real()));
+		err = std::max(err, std::fabs(double(x[i].imag()) - ref[i].imag()));
+		scale = std::max({scale, std::fabs(ref[i].real()), std::fabs(ref[i].imag())});
+	}
+	return err / scale;
+}
+
+template <typename T>
+static void checkSize(std::size_t n, double tolerance, std::mt19937 &rng)
+{
+	std::uniform_real_distribution<double> u(-1, 1);
+	std::vector<Complex<double>> input(n);
+	ComplexBuffer<T> x;
+	for (std::size_t i = 0; i < n; ++i)
+	{
+		input[i] = Complex<double>(u(rng), u(rng));
+		x.push_back(Complex<T>(T(input[i].real()), T(input[i].imag())));
+	}
+	// the reference transforms the values actually stored in x
+	for (std::size_t i = 0; i < n; ++i)
+		input[i] = Complex<double>(x[i].real(), x[i].imag());
+
+	dsp::FftPlan<T> plan(n);
+	plan.forward(x);
+	double err = maxError(x, naiveDft(input));
+	check(err < tolerance, "forward vs naive DFT", n, err);
+
+	plan.inverse(x);
+	err = maxError(x, input);
+	check(err < tolerance, "inverse(forward(x)) == x", n, err);
+}
+
+static void checkKnownValues()
+{
+	// an impulse transforms to all ones, a constant to an impulse
+	dsp::FftPlan<double> plan(12);
+	ComplexBuffer<double> x(12);
+	x.set(0, Complex<double>(1, 0));
+	plan.forward(x);
+	for (std::size_t i = 0; i < 12; ++i)
+		check(x[i] == Complex<double>(1, 0), "impulse", 12, 0);
+
+	plan.forward(x);
+	double err = std::fabs(x[0].real() - 12);
+	for (std::size_t i = 1; i < 12; ++i)
+		err = std::max({err, std::fabs(x[i].real()), std::fabs(x[i].imag())});
+	check(err < 1e-12, "constant", 12, err);
+
+	// a tone at bin 3 of 16 lands in bin 3 only
+	dsp::FftPlan<float> tone(16);
+	ComplexBuffer<float> y;
+	for (std::size_t i = 0; i < 16; ++i)
+	{
+		double a = 2 * std::acos(-1.0) * 3 * double(i) / 16;
+		y.push_back(Complex<float>(float(std::cos(a)), float(std::sin(a))));
+	}
+	tone.forward(y);
+	err = std::fabs(y[3].real() - 16);
+	for (std::size_t i = 0; i < 16; ++i)
+		if (i != 3)
+			err = std::max(err, double(y[i].abs()));
+	check(err < 1e-4, "tone", 16, err);
+}
+
+static void checkPlanner()
+{
+	dsp::FftPlanner<double> planner;
+	const dsp::FftPlan<double> &a = planner.plan(1024);
+	const dsp::FftPlan<double> &b = planner.plan(1024);
+	check(&a == &b, "planner reuses plans", 1024, 0);
+	planner.plan(360);
+	check(planner.size() == 2, "planner size", 2, double(planner.size()));
+
+	bool threw = false;
+	try
+	{
+		planner.plan(0);
+	}
+	catch (const std::invalid_argument &)
+	{
+		threw = true;
+	}
+	check(threw && planner.size() == 2, "size 0 throws", 0, 0);
+
+	threw = false;
+	ComplexBuffer<double> x(100);
+	try
+	{
+		a.forward(x);
+	}
+	catch (const std::invalid_argument &)
+	{
+		threw = true;
+	}
+	check(threw, "size mismatch throws", 100, 0);
+
+	std::vector<std::size_t> f = planner.plan(360).factors();
+	check(f == std::vector<std::size_t>{4, 2, 3, 3, 5}, "factors of 360", 360, 0);
+}
+
+int main()
+{
+	std::mt19937 rng(20);
+	const std::size_t sizes[] = {1, 2, 3, 4, 5, 6, 7, 8, 12, 16, 30, 64, 97, 100, 128, 243,
+	                             360, 1000, 1024, 2048, 4096, 6000, 8192, 2 * 3 * 5 * 7 * 11};
+	for (std::size_t n : sizes)
+	{
+		checkSize<double>(n, 1e-12, rng);
+		checkSize<float>(n, 5e-6, rng);
+	}
+	checkKnownValues();
+	checkPlanner();
+
+	if (failures)
+		return EXIT_FAILURE;
+	std::printf("FFT checks passed\n");
+}
@@ -0,0 +1,81 @@
+// Multi-threaded queue throughput: LockFreeQueue versus a LinkedList
+// guarded by a std::mutex, from 1 thread up to N (default: all hardware
+// threads, at least 4). Every thread alternates push_back and pop_front,
+// so the queue stays short and all threads contend on both ends.
+//
+//   g++ -std=c++17 -O2 -pthread -Iinclude bench/mpmc_queue_bench.cpp
+//       src/LinkedList.cpp src/NodePool.cpp src/LockFreeQueue.cpp
+//       src/HazardPointers.cpp -o mpmc_bench
+//   ./mpmc_bench [max_threads] [ops_per_thread]
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "LinkedList.hpp"
+#include "LockFreeQueue.hpp"
+
+struct MutexQueue {
+    std::mutex m;
+    LinkedList list;
+
+    void push_back(int v) {
+        std::lock_guard<std::mutex> lock(m);
+        list.push_back(v);
+    }
+    bool pop_front(int& out) {
+        std::lock_guard<std::mutex> lock(m);
+        if (list.empty()) return false;
+        out = list.pop_front();
+        return true;
+    }
+};
+
+template <typename Queue>
+static double mops(unsigned threads, std::size_t ops) {
+    Queue q;
+    std::atomic<bool> go{false};
+    std::atomic<long long> sink{0};
+    std::vector<std::thread> pool;
+
+    for (unsigned t = 0; t < threads; ++t) {
+        pool.emplace_back([&] {
+            while (!go.load(std::memory_order_acquire)) {}
+            long long local = 0;
+            int v;
+            for (std::size_t i = 0; i < ops; ++i) {
+                q.push_back(static_cast<int>(i));
+                if (q.pop_front(v)) local += v;
+            }
+            sink += local;
+        });
+    }
+    auto t0 = std::chrono::steady_clock::now();
+    go.store(true, std::memory_order_release);
+    for (auto& th : pool) th.join();
+    double s = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    return 2.0 * threads * ops / s / 1e6;
+}
+
+// 1, 2, 4, ... below max_threads, then max_threads itself
+static std::vector<unsigned> thread_counts(unsigned max_threads) {
+    std::vector<unsigned> counts;
+    for (unsigned t = 1; t < max_threads; t *= 2) counts.push_back(t);
+    counts.push_back(max_threads);
+    return counts;
+}
+
+int main(int argc, char** argv) {
+    unsigned hw = std::thread::hardware_concurrency();
+    unsigned max_threads = argc > 1 ? std::atoi(argv[1]) : (hw > 4 ? hw : 4);
+    std::size_t ops = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 1'000'000;
+
+    std::printf("%u hardware threads, %zu push+pop pairs per thread\n\n", hw, ops);
+    std::printf("threads   mutex+LinkedList   LockFreeQueue   (Mops/s)\n");
+    for (unsigned t : thread_counts(max_threads))
+        std::printf("%7u %18.2f %15.2f\n", t, mops<MutexQueue>(t, ops), mops<LockFreeQueue>(t, ops));
+    return 0;
+}
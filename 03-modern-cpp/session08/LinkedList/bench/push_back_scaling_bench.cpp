@@ -0,0 +1,55 @@
+// Build time of a list through push_back alone, from 10k to 10M elements.
+// With the tail pointer the cost per element stays flat (linear build);
+// the old head-to-tail walk made it grow with the list (quadratic build).
+// Also drains the doubly-linked list with pop_back, now O(1) per call.
+//
+//   g++ -std=c++17 -O2 -Iinclude bench/push_back_scaling_bench.cpp
+//       src/LinkedList.cpp src/NodePool.cpp -o scaling_bench
+//   ./scaling_bench [max_elements]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include "LinkedList.hpp"
+
+using Clock = std::chrono::steady_clock;
+
+static double ms_since(Clock::time_point t0) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+}
+
+template <typename List>
+static void row(std::size_t n) {
+    List list;
+    auto t0 = Clock::now();
+    for (std::size_t i = 0; i < n; ++i) list.push_back(static_cast<int>(i));
+    double build = ms_since(t0);
+
+    double drain = 0;
+    if constexpr (std::is_same_v<List, DoublyLinkedList>) {
+        t0 = Clock::now();
+        while (!list.empty()) list.pop_back();
+        drain = ms_since(t0);
+    }
+
+    std::printf("%10zu %12.1f ms %10.1f ns/elem", n, build, build * 1e6 / n);
+    if (drain > 0) std::printf(" | pop_back drain %10.1f ms %8.1f ns/elem", drain, drain * 1e6 / n);
+    std::printf("\n");
+}
+
+template <typename List>
+static void table(const char* name, std::size_t max_n) {
+    std::printf("\n%s\n", name);
+    for (std::size_t n = 10'000; n <= max_n; n *= 10) row<List>(n);
+}
+
+int main(int argc, char** argv) {
+    std::size_t max_n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10'000'000;
+
+    // fault the heap in first so the first table does not pay for it
+    { DoublyLinkedList warm; for (std::size_t i = 0; i < max_n; ++i) warm.push_back(0); }
+
+    table<LinkedList>("LinkedList (singly linked + tail)", max_n);
+    table<DoublyLinkedList>("DoublyLinkedList", max_n);
+    return 0;
+}
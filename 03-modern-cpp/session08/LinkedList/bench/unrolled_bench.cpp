@@ -0,0 +1,117 @@
+// Traversal and removal throughput of LinkedList versus UnrolledLinkedList
+// at 1M elements. Lists are built while unrelated allocations come and go.
+// LinkedList takes its nodes from its own slab pool, so they stay packed in
+// push order anyway; HeapList is the same list with a plain new per node,
+// whose nodes end up scattered the way they do in a long-running process.
+// Expect the pooled LinkedList to match or beat UnrolledLinkedList, and
+// the scattered HeapList to trail both by an order of magnitude.
+//
+//   g++ -std=c++17 -O2 -Iinclude bench/unrolled_bench.cpp
+//       src/LinkedList.cpp src/NodePool.cpp src/UnrolledLinkedList.cpp -o unrolled_bench
+//   ./unrolled_bench [elements]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+#include "LinkedList.hpp"
+#include "UnrolledLinkedList.hpp"
+
+using Clock = std::chrono::steady_clock;
+
+// LinkedList without the pool: one new/delete per node
+class HeapList {
+public:
+    HeapList() = default;
+    ~HeapList() {
+        while (head) {
+            Node* next = head->next;
+            delete head;
+            head = next;
+        }
+    }
+
+    HeapList(const HeapList&) = delete;
+    HeapList& operator=(const HeapList&) = delete;
+
+    void push_front(int v) {
+        head = new Node{v, head};
+        ++count;
+    }
+
+    bool remove(int v) {
+        for (Node** link = &head; *link; link = &(*link)->next) {
+            if ((*link)->value == v) {
+                Node* node = *link;
+                *link = node->next;
+                delete node;
+                --count;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    std::size_t size() const noexcept { return count; }
+
+private:
+    struct Node {
+        int   value;
+        Node* next;
+    };
+
+    Node* head = nullptr;
+    std::size_t count = 0;
+};
+
+static double ms_since(Clock::time_point t0) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+}
+
+template <typename List>
+static void run(const char* name, std::size_t n) {
+    std::mt19937 rng(1);
+    std::vector<void*> churn;
+    churn.reserve(n);
+
+    List list;
+    for (std::size_t i = 0; i < n; ++i) {
+        list.push_front(static_cast<int>(n - i));
+        churn.push_back(std::malloc(16 + rng() % 64));
+        if (rng() % 2) {
+            std::size_t k = rng() % churn.size();
+            std::free(churn[k]);
+            churn[k] = churn.back();
+            churn.pop_back();
+        }
+    }
+
+    // remove() of an absent value walks every element
+    const int passes = 10;
+    auto t0 = Clock::now();
+    for (int p = 0; p < passes; ++p) list.remove(-1);
+    double walk_ms = ms_since(t0);
+
+    // remove present values spread over the whole list
+    const int removals = 200;
+    std::uniform_int_distribution<int> pick(1, static_cast<int>(n));
+    t0 = Clock::now();
+    for (int r = 0; r < removals; ++r) list.remove(pick(rng));
+    double remove_ms = ms_since(t0);
+
+    std::printf("%-20s traverse %8.1f Melem/s | %6d removals %8.1f ms (%6.0f us each) | size %zu\n",
+                name, passes * double(n) / walk_ms / 1e3, removals, remove_ms,
+                remove_ms * 1e3 / removals, list.size());
+
+    for (void* p : churn) std::free(p);
+}
+
+int main(int argc, char** argv) {
+    std::size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1'000'000;
+    std::printf("%zu elements, %zu values per unrolled node\n\n", n, UnrolledLinkedList::kNodeCapacity);
+    run<LinkedList>("LinkedList", n);
+    run<HeapList>("HeapList", n);
+    run<UnrolledLinkedList>("UnrolledLinkedList", n);
+    return 0;
+}
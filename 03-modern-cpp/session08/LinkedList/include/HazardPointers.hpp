@@ -0,0 +1,46 @@
+#ifndef HAZARDPOINTERS_HPP
+#define HAZARDPOINTERS_HPP
+
+#include <atomic>
+#include <cstddef>
+
+// Hazard-pointer based memory reclamation for lock-free structures.
+//
+// A thread announces "I am about to dereference p" by publishing p in
+// one of its hazard slots. A retired object is only deleted once no
+// slot of any thread still holds it. Each thread gets its slots the
+// first time it calls in; when the thread exits, the slots go back to
+// a shared registry for reuse. Objects still retired at program exit
+// are deleted then.
+class HazardPointers {
+public:
+    static constexpr std::size_t kSlotsPerThread = 2;
+
+    using Deleter = void (*)(void*);
+
+    // Loads src into hazard slot `slot` and returns it, retrying until
+    // the published value is confirmed to still be current.
+    template <typename T>
+    static T* protect(std::size_t slot, const std::atomic<T*>& src) {
+        std::atomic<void*>& hp = hazard(slot);
+        T* p = src.load(std::memory_order_relaxed);
+        for (;;) {
+            hp.store(p, std::memory_order_seq_cst);
+            T* q = src.load(std::memory_order_seq_cst);
+            if (q == p) return p;
+            p = q;
+        }
+    }
+
+    // Publishes p without validation; the caller re-checks its source.
+    static void set(std::size_t slot, void* p);
+    static void clear(std::size_t slot);
+
+    // Hands p over for deferred deletion once no thread protects it
+    static void retire(void* p, Deleter d);
+
+private:
+    static std::atomic<void*>& hazard(std::size_t slot);
+};
+
+#endif // HAZARDPOINTERS_HPP
@@ -3,11 +3,23 @@
 
 #include <iostream>
 #include <stdexcept>
+#include <type_traits>
 
-class LinkedList {
+#include "NodePool.hpp"
+
+// Single: nodes hold only a next pointer. push_back and back() are O(1)
+//         thanks to the tail pointer; pop_back still walks the list.
+// Double: nodes also hold a prev pointer, which makes pop_back O(1) too.
+enum class Links { Single, Double };
+
+template <Links L>
+class BasicLinkedList {
 public:
-    LinkedList() = default;
-    ~LinkedList();
+    BasicLinkedList() = default;
+    ~BasicLinkedList();
+
+    BasicLinkedList(const BasicLinkedList&) = delete;
+    BasicLinkedList& operator=(const BasicLinkedList&) = delete;
 
     // push to front and back
     void push_front(int v);
@@ -27,19 +39,43 @@ public:
     void clear() noexcept;
     bool remove(int v);
 
+    // clear() and also hand the node slabs back to the system
+    void release_memory() noexcept;
+
+    // node allocation counters, e.g. to check that a warmed-up list no
+    // longer allocates (slab_allocs stays constant)
+    const NodePool::Stats& allocation_stats() const noexcept;
+
     // print all elements
     void print() const;
 
 private:
-    class Node {
+    // prev link only exists in doubly-linked mode (empty base otherwise)
+    template <typename N>
+    struct PrevLink { N* prev = nullptr; };
+    struct NoPrevLink {};
+
+    class Node : public std::conditional_t<L == Links::Double, PrevLink<Node>, NoPrevLink> {
     public:
         int   value;
         Node* next;
         Node(int v, Node* n);
     };
 
+    // nodes come from a per-list pool rather than new/delete
+    NodePool pool{sizeof(Node), alignof(Node)};
     Node* head = nullptr;
+    Node* tail = nullptr;
     std::size_t count = 0;
+
+    Node* make_node(int v, Node* next);
+    void unlink(Node* prev, Node* node) noexcept;
 };
 
+using LinkedList       = BasicLinkedList<Links::Single>;
+using DoublyLinkedList = BasicLinkedList<Links::Double>;
+
+extern template class BasicLinkedList<Links::Single>;
+extern template class BasicLinkedList<Links::Double>;
+
 #endif // LINKEDLIST_HPP
@@ -0,0 +1,44 @@
+#ifndef LOCKFREEQUEUE_HPP
+#define LOCKFREEQUEUE_HPP
+
+#include <atomic>
+#include <cstddef>
+
+// Unbounded multi-producer/multi-consumer FIFO of ints (Michael & Scott,
+// 1996). push_back and pop_front may be called from any number of
+// threads at once without locks. Dequeued nodes are reclaimed through
+// hazard pointers, so a node is never freed while another thread can
+// still read it.
+class LockFreeQueue {
+public:
+    LockFreeQueue();
+    ~LockFreeQueue();
+
+    LockFreeQueue(const LockFreeQueue&) = delete;
+    LockFreeQueue& operator=(const LockFreeQueue&) = delete;
+
+    void push_back(int v);
+
+    // removes the oldest value into out; false if the queue was empty
+    bool pop_front(int& out);
+
+    // snapshot only: another thread may change it right away
+    bool empty() const;
+
+private:
+    struct Node {
+        int                value;
+        std::atomic<Node*> next;
+        explicit Node(int v);
+    };
+
+    static void delete_node(void* p);
+
+    // head points at a dummy node; the front value lives in head->next.
+    // Kept on separate cache lines so producers and consumers do not
+    // invalidate each other's line.
+    alignas(64) std::atomic<Node*> head;
+    alignas(64) std::atomic<Node*> tail;
+};
+
+#endif // LOCKFREEQUEUE_HPP
@@ -0,0 +1,65 @@
+#ifndef NODEPOOL_HPP
+#define NODEPOOL_HPP
+
+#include <cstddef>
+
+// Fixed-size block allocator for list nodes. Blocks are carved out of
+// slabs, and freed blocks go onto an intrusive free list for reuse. Once
+// a list has warmed up, push/pop cycles no longer call into malloc.
+//
+// reset() releases every block at once without touching them (blocks
+// must be trivially destructible or already destroyed). The slabs are
+// kept for reuse. release() also returns the slabs to the system.
+class NodePool {
+public:
+    struct Stats {
+        std::size_t slab_allocs = 0;   // calls into the system allocator
+        std::size_t block_allocs = 0;  // allocate() calls
+        std::size_t reused = 0;        // allocate() served from the free list
+        std::size_t live = 0;          // blocks currently handed out
+        std::size_t capacity = 0;      // blocks held in all slabs
+    };
+
+    NodePool(std::size_t block_size, std::size_t block_align);
+    ~NodePool();
+
+    NodePool(const NodePool&) = delete;
+    NodePool& operator=(const NodePool&) = delete;
+
+    void* allocate();
+    void deallocate(void* p) noexcept;
+
+    void reset() noexcept;
+    void release() noexcept;
+
+    const Stats& stats() const noexcept;
+
+private:
+    struct Slab {
+        Slab*       next;
+        std::size_t blocks;
+    };
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    static constexpr std::size_t kFirstSlabBlocks = 64;
+    static constexpr std::size_t kMaxSlabBlocks = 4096;
+
+    std::size_t block_size_;
+    std::size_t block_align_;
+    std::size_t header_size_;      // Slab header rounded up to block_align_
+
+    Slab*       slabs_ = nullptr;  // in allocation order
+    Slab*       last_slab_ = nullptr;
+    Slab*       cur_ = nullptr;    // slab being carved
+    std::size_t cur_used_ = 0;     // blocks carved from cur_
+    FreeBlock*  free_ = nullptr;
+    Stats       stats_;
+
+    void* carve();
+    void add_slab();
+    char* block_at(Slab* s, std::size_t i) const noexcept;
+};
+
+#endif // NODEPOOL_HPP
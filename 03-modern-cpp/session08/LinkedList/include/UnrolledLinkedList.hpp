@@ -0,0 +1,68 @@
+#ifndef UNROLLEDLINKEDLIST_HPP
+#define UNROLLEDLINKEDLIST_HPP
+
+#include <cstddef>
+#include <iostream>
+#include <stdexcept>
+
+// Drop-in alternative to LinkedList that stores several values per node.
+// Each node fills exactly one cache line, so a traversal touches roughly
+// one line per kNodeCapacity elements instead of one scattered allocation
+// per element.
+class UnrolledLinkedList {
+public:
+    static constexpr std::size_t kCacheLine = 64;
+    // values per node: whatever fits beside the next pointer and the
+    // two offsets (13 on 64-bit targets, 14 on 32-bit ones)
+    static constexpr std::size_t kNodeCapacity =
+        (kCacheLine - sizeof(void*) - 2 * sizeof(unsigned short)) / sizeof(int);
+
+    UnrolledLinkedList() = default;
+    ~UnrolledLinkedList();
+
+    UnrolledLinkedList(const UnrolledLinkedList&) = delete;
+    UnrolledLinkedList& operator=(const UnrolledLinkedList&) = delete;
+
+    // push to front and back
+    void push_front(int v);
+    void push_back(int v);
+
+    // pop from front and back; throw if empty
+    int pop_front();
+    int pop_back();
+
+    // peek at front/back without removing; throw if empty
+    int front() const;
+    int back() const;
+
+    // utilities
+    bool empty() const noexcept;
+    std::size_t size() const noexcept;
+    void clear() noexcept;
+    bool remove(int v);
+
+    // print all elements
+    void print() const;
+
+private:
+    class alignas(kCacheLine) Node {
+    public:
+        Node*          next;
+        unsigned short first;   // live values are values[first, last)
+        unsigned short last;
+        int            values[kNodeCapacity];
+
+        Node(Node* n, unsigned short start);
+        std::size_t count() const noexcept;
+    };
+    static_assert(sizeof(Node) == kCacheLine, "Node must fill one cache line");
+
+    Node* head = nullptr;
+    Node* tail = nullptr;
+    std::size_t count = 0;
+
+    Node* find_prev(Node* node) const noexcept;
+    void unlink(Node* prev, Node* node) noexcept;
+};
+
+#endif // UNROLLEDLINKEDLIST_HPP
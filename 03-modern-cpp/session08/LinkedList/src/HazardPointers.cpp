@@ -0,0 +1,115 @@
+#include "HazardPointers.hpp"
+#include <algorithm>
+#include <vector>
+
+namespace {
+
+struct Retired {
+    void* ptr;
+    HazardPointers::Deleter deleter;
+};
+
+// One per thread that has used hazard pointers; never freed while the
+// program runs, only recycled between threads.
+struct Record {
+    std::atomic<void*> hp[HazardPointers::kSlotsPerThread] = {};
+    std::atomic<bool>  active{false};
+    Record*            next = nullptr;
+    std::vector<Retired> retired;
+};
+
+std::atomic<Record*>     g_records{nullptr};
+std::atomic<std::size_t> g_record_count{0};
+
+Record* acquire_record() {
+    for (Record* r = g_records.load(std::memory_order_acquire); r; r = r->next) {
+        bool expected = false;
+        if (!r->active.load(std::memory_order_relaxed) &&
+            r->active.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+            return r;
+        }
+    }
+
+    Record* r = new Record;
+    r->active.store(true, std::memory_order_relaxed);
+    Record* head = g_records.load(std::memory_order_relaxed);
+    do {
+        r->next = head;
+    } while (!g_records.compare_exchange_weak(head, r, std::memory_order_release,
+                                              std::memory_order_relaxed));
+    g_record_count.fetch_add(1, std::memory_order_relaxed);
+    return r;
+}
+
+// Deletes every retired object of r that no hazard slot protects
+void scan(Record& r) {
+    std::vector<void*> hazards;
+    for (Record* p = g_records.load(std::memory_order_acquire); p; p = p->next) {
+        for (auto& hp : p->hp) {
+            if (void* h = hp.load(std::memory_order_seq_cst)) hazards.push_back(h);
+        }
+    }
+    std::sort(hazards.begin(), hazards.end());
+
+    std::vector<Retired> keep;
+    for (const Retired& x : r.retired) {
+        if (std::binary_search(hazards.begin(), hazards.end(), x.ptr))
+            keep.push_back(x);
+        else
+            x.deleter(x.ptr);
+    }
+    r.retired.swap(keep);
+}
+
+// Gives the record back when its thread exits; leftover retired objects
+// travel with the record to its next owner.
+struct Owner {
+    Record* rec = acquire_record();
+    ~Owner() {
+        for (auto& hp : rec->hp) hp.store(nullptr, std::memory_order_release);
+        rec->active.store(false, std::memory_order_release);
+    }
+};
+
+Record& self() {
+    thread_local Owner owner;
+    return *owner.rec;
+}
+
+// At exit no other thread is running: free whatever is still retired
+struct Reaper {
+    ~Reaper() {
+        Record* r = g_records.exchange(nullptr, std::memory_order_acquire);
+        while (r) {
+            for (const Retired& x : r->retired) x.deleter(x.ptr);
+            Record* next = r->next;
+            if (!r->active.load(std::memory_order_relaxed)) delete r;
+            r = next;
+        }
+    }
+} g_reaper;
+
+} // namespace
+
+std::atomic<void*>& HazardPointers::hazard(std::size_t slot) {
+    return self().hp[slot];
+}
+
+void HazardPointers::set(std::size_t slot, void* p) {
+    hazard(slot).store(p, std::memory_order_seq_cst);
+}
+
+void HazardPointers::clear(std::size_t slot) {
+    hazard(slot).store(nullptr, std::memory_order_release);
+}
+
+void HazardPointers::retire(void* p, Deleter d) {
+    Record& r = self();
+    r.retired.push_back({p, d});
+
+    // Amortise scans: at most kSlotsPerThread * threads entries can be
+    // protected, so a threshold of twice that frees at least half per scan.
+    std::size_t threshold = 2 * kSlotsPerThread * g_record_count.load(std::memory_order_relaxed);
+    if (r.retired.size() >= std::max<std::size_t>(threshold, 64))
+        scan(r);
+}
@@ -1,76 +1,85 @@
 #include "LinkedList.hpp"
+#include <new>
 
 //–– Node ctor ––//
-LinkedList::Node::Node(int v, Node* n)
+template <Links L>
+BasicLinkedList<L>::Node::Node(int v, Node* n)
     : value(v), next(n)
 {}
 
 //–– dtor ––//
-LinkedList::~LinkedList() {
+template <Links L>
+BasicLinkedList<L>::~BasicLinkedList() {
     clear();
 }
 
 //–– pushFront ––//
-void LinkedList::push_front(int v) {
-    head = new Node(v, head);
+template <Links L>
+void BasicLinkedList<L>::push_front(int v) {
+    Node* n = make_node(v, head);
+    if constexpr (L == Links::Double) {
+        if (head) head->prev = n;
+    }
+    head = n;
+    if (!tail) tail = n;
     ++count;
 }
 
 //–– pushBack ––//
-void LinkedList::push_back(int v) {
+template <Links L>
+void BasicLinkedList<L>::push_back(int v) {
+    Node* n = make_node(v, nullptr);
     if (empty()) {
-        head = new Node(v, nullptr);
+        head = n;
     } else {
-        Node* p = head;
-        while (p->next) {
-            p = p->next;
+        if constexpr (L == Links::Double) {
+            n->prev = tail;
         }
-        p->next = new Node(v, nullptr);
+        tail->next = n;
     }
+    tail = n;
     ++count;
 }
 
 //–– popFront ––//
-int LinkedList::pop_front() {
+template <Links L>
+int BasicLinkedList<L>::pop_front() {
     if (empty()) {
         throw std::underflow_error("popFront() on empty list");
     }
-    Node* tmp = head;
-    int val = tmp->value;
-    head = head->next;
-    delete tmp;
-    --count;
+    int val = head->value;
+    unlink(nullptr, head);
     return val;
 }
 
 //–– popBack ––//
-int LinkedList::pop_back() {
+template <Links L>
+int BasicLinkedList<L>::pop_back() {
     if (empty()) {
         throw std::underflow_error("popBack() on empty list");
     }
-    // single element?
-    if (!head->next) {
-        int val = head->value;
-        delete head;
-        head = nullptr;
-        --count;
-        return val;
-    }
-    // walk to second-last
-    Node* p = head;
-    while (p->next->next) {
-        p = p->next;
+    int val = tail->value;
+    if constexpr (L == Links::Double) {
+        unlink(tail->prev, tail);
+    } else {
+        // single element?
+        if (head == tail) {
+            unlink(nullptr, head);
+            return val;
+        }
+        // walk to second-last
+        Node* p = head;
+        while (p->next != tail) {
+            p = p->next;
+        }
+        unlink(p, tail);
     }
-    // p->next is last
-    int val = p->next->value;
-    delete p->next;
-    p->next = nullptr;
-    --count;
     return val;
 }
 
 //–– front ––//
-int LinkedList::front() const {
+template <Links L>
+int BasicLinkedList<L>::front() const {
     if (empty()) {
         throw std::underflow_error("front() on empty list");
     }
@@ -78,59 +87,99 @@ int LinkedList::front() const {
 }
 
 //–– back ––//
-int LinkedList::back() const {
+template <Links L>
+int BasicLinkedList<L>::back() const {
     if (empty()) {
         throw std::underflow_error("back() on empty list");
     }
-    Node* p = head;
-    while (p->next) {
-        p = p->next;
-    }
-    return p->value;
+    return tail->value;
 }
 
 //–– empty ––//
-bool LinkedList::empty() const noexcept {
+template <Links L>
+bool BasicLinkedList<L>::empty() const noexcept {
     return head == nullptr;
 }
 
 //–– size ––//
-std::size_t LinkedList::size() const noexcept {
+template <Links L>
+std::size_t BasicLinkedList<L>::size() const noexcept {
     return count;
 }
 
 //–– remove ––//
-bool LinkedList::remove(int v) {
-    Node** cur = &head;
-    while (*cur) {
-        if ((*cur)->value == v) {
-            Node* toDelete = *cur;
-            *cur = (*cur)->next;
-            delete toDelete;
-            --count;
+template <Links L>
+bool BasicLinkedList<L>::remove(int v) {
+    Node* prev = nullptr;
+    for (Node* p = head; p; prev = p, p = p->next) {
+        if (p->value == v) {
+            unlink(prev, p);
             return true;
         }
-        cur = &((*cur)->next);
     }
     return false;
 }
 
 //–– clear ––//
-void LinkedList::clear() noexcept {
-    Node* p = head;
-    while (p) {
-        Node* tmp = p->next;
-        delete p;
-        p = tmp;
-    }
+// Nodes are trivially destructible, so the pool takes them all back at
+// once instead of walking the list; the slabs stay around for reuse.
+template <Links L>
+void BasicLinkedList<L>::clear() noexcept {
+    static_assert(std::is_trivially_destructible_v<Node>,
+                  "clear() releases nodes without destroying them");
+    pool.reset();
     head = nullptr;
+    tail = nullptr;
     count = 0;
 }
 
+//–– releaseMemory ––//
+template <Links L>
+void BasicLinkedList<L>::release_memory() noexcept {
+    clear();
+    pool.release();
+}
+
+//–– allocationStats ––//
+template <Links L>
+const NodePool::Stats& BasicLinkedList<L>::allocation_stats() const noexcept {
+    return pool.stats();
+}
+
 //–– print ––//
-void LinkedList::print() const {
+template <Links L>
+void BasicLinkedList<L>::print() const {
     for (Node* p = head; p; p = p->next) {
         std::cout << p->value << ' ';
     }
     std::cout << "\n";
 }
+
+//–– makeNode ––//
+template <Links L>
+typename BasicLinkedList<L>::Node* BasicLinkedList<L>::make_node(int v, Node* next) {
+    return new (pool.allocate()) Node(v, next);
+}
+
+//–– unlink ––//
+// Detaches node (whose predecessor is prev, or nullptr for head) and frees it
+template <Links L>
+void BasicLinkedList<L>::unlink(Node* prev, Node* node) noexcept {
+    if (prev) prev->next = node->next;
+    else head = node->next;
+
+    if (node->next) {
+        if constexpr (L == Links::Double) {
+            node->next->prev = prev;
+        }
+    } else {
+        tail = prev;
+    }
+
+    node->~Node();
+    pool.deallocate(node);
+    --count;
+}
+
+template class BasicLinkedList<Links::Single>;
+template class BasicLinkedList<Links::Double>;
@@ -0,0 +1,96 @@
+#include "LockFreeQueue.hpp"
+#include "HazardPointers.hpp"
+
+//–– Node ctor ––//
+LockFreeQueue::Node::Node(int v)
+    : value(v), next(nullptr)
+{}
+
+//–– ctor / dtor ––//
+LockFreeQueue::LockFreeQueue() {
+    Node* dummy = new Node(0);
+    head.store(dummy, std::memory_order_relaxed);
+    tail.store(dummy, std::memory_order_relaxed);
+}
+
+// No other thread may use the queue any more
+LockFreeQueue::~LockFreeQueue() {
+    Node* p = head.load(std::memory_order_relaxed);
+    while (p) {
+        Node* tmp = p->next.load(std::memory_order_relaxed);
+        delete p;
+        p = tmp;
+    }
+}
+
+//–– pushBack ––//
+void LockFreeQueue::push_back(int v) {
+    Node* n = new Node(v);
+    for (;;) {
+        Node* t = HazardPointers::protect(0, tail);
+        Node* next = t->next.load(std::memory_order_acquire);
+        if (t != tail.load(std::memory_order_acquire)) continue;
+
+        if (next) {
+            // tail is lagging behind: help the other producer finish
+            tail.compare_exchange_weak(t, next, std::memory_order_release,
+                                       std::memory_order_relaxed);
+            continue;
+        }
+        if (t->next.compare_exchange_weak(next, n, std::memory_order_release,
+                                          std::memory_order_relaxed)) {
+            // linked in; swinging tail may fail if someone helped already
+            tail.compare_exchange_strong(t, n, std::memory_order_release,
+                                         std::memory_order_relaxed);
+            break;
+        }
+    }
+    HazardPointers::clear(0);
+}
+
+//–– popFront ––//
+bool LockFreeQueue::pop_front(int& out) {
+    for (;;) {
+        Node* h = HazardPointers::protect(0, head);
+        Node* t = tail.load(std::memory_order_acquire);
+        Node* next = h->next.load(std::memory_order_acquire);
+        HazardPointers::set(1, next);
+        // h still being head proves next was not retired before we
+        // published it
+        if (h != head.load(std::memory_order_seq_cst)) continue;
+
+        if (!next) {
+            HazardPointers::clear(0);
+            HazardPointers::clear(1);
+            return false;
+        }
+        if (h == t) {
+            // tail is lagging behind the last node: advance it first
+            tail.compare_exchange_weak(t, next, std::memory_order_release,
+                                       std::memory_order_relaxed);
+            continue;
+        }
+        int val = next->value;
+        if (head.compare_exchange_weak(h, next, std::memory_order_acq_rel,
+                                       std::memory_order_relaxed)) {
+            HazardPointers::clear(0);
+            HazardPointers::clear(1);
+            HazardPointers::retire(h, &LockFreeQueue::delete_node);
+            out = val;
+            return true;
+        }
+    }
+}
+
+//–– empty ––//
+bool LockFreeQueue::empty() const {
+    Node* h = HazardPointers::protect(0, head);
+    bool none = h->next.load(std::memory_order_acquire) == nullptr;
+    HazardPointers::clear(0);
+    return none;
+}
+
+//–– helpers ––//
+void LockFreeQueue::delete_node(void* p) {
+    delete static_cast<Node*>(p);
+}
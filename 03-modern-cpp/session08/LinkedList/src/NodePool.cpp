@@ -0,0 +1,111 @@
+#include "NodePool.hpp"
+#include <algorithm>
+#include <new>
+
+//–– ctor / dtor ––//
+NodePool::NodePool(std::size_t block_size, std::size_t block_align)
+    : block_size_(std::max(block_size, sizeof(FreeBlock)))
+    , block_align_(std::max(block_align, alignof(FreeBlock)))
+    , header_size_(0)
+{
+    block_size_ = (block_size_ + block_align_ - 1) / block_align_ * block_align_;
+    header_size_ = (sizeof(Slab) + block_align_ - 1) / block_align_ * block_align_;
+}
+
+NodePool::~NodePool() {
+    release();
+}
+
+//–– allocate ––//
+void* NodePool::allocate() {
+    ++stats_.block_allocs;
+    ++stats_.live;
+    if (free_) {
+        FreeBlock* b = free_;
+        free_ = b->next;
+        ++stats_.reused;
+        return b;
+    }
+    return carve();
+}
+
+//–– deallocate ––//
+void NodePool::deallocate(void* p) noexcept {
+    if (!p) return;
+    FreeBlock* b = static_cast<FreeBlock*>(p);
+    b->next = free_;
+    free_ = b;
+    --stats_.live;
+}
+
+//–– reset ––//
+void NodePool::reset() noexcept {
+    free_ = nullptr;
+    cur_ = slabs_;
+    cur_used_ = 0;
+    stats_.live = 0;
+}
+
+//–– release ––//
+void NodePool::release() noexcept {
+    Slab* s = slabs_;
+    while (s) {
+        Slab* tmp = s->next;
+        ::operator delete(static_cast<void*>(s), std::align_val_t(block_align_));
+        s = tmp;
+    }
+    slabs_ = last_slab_ = cur_ = nullptr;
+    cur_used_ = 0;
+    free_ = nullptr;
+    stats_.live = 0;
+    stats_.capacity = 0;
+}
+
+//–– stats ––//
+const NodePool::Stats& NodePool::stats() const noexcept {
+    return stats_;
+}
+
+//–– helpers ––//
+// Hands out the next never-used block, moving on to the next slab (or
+// allocating a new one) when the current slab is exhausted.
+void* NodePool::carve() {
+    while (!cur_ || cur_used_ == cur_->blocks) {
+        if (cur_ && cur_->next) {
+            cur_ = cur_->next;
+            cur_used_ = 0;
+        } else {
+            try {
+                add_slab();
+            } catch (...) {
+                --stats_.block_allocs;
+                --stats_.live;
+                throw;
+            }
+        }
+    }
+    return block_at(cur_, cur_used_++);
+}
+
+void NodePool::add_slab() {
+    // slabs double in size up to kMaxSlabBlocks
+    std::size_t blocks = last_slab_ ? std::min(last_slab_->blocks * 2, kMaxSlabBlocks)
+                                    : kFirstSlabBlocks;
+    void* mem = ::operator new(header_size_ + blocks * block_size_, std::align_val_t(block_align_));
+
+    Slab* s = static_cast<Slab*>(mem);
+    s->next = nullptr;
+    s->blocks = blocks;
+    if (last_slab_) last_slab_->next = s;
+    else slabs_ = s;
+    last_slab_ = s;
+
+    cur_ = s;
+    cur_used_ = 0;
+    ++stats_.slab_allocs;
+    stats_.capacity += blocks;
+}
+
+char* NodePool::block_at(Slab* s, std::size_t i) const noexcept {
+    return reinterpret_cast<char*>(s) + header_size_ + i * block_size_;
+}
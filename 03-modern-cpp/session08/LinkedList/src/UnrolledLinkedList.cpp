@@ -0,0 +1,165 @@
+#include "UnrolledLinkedList.hpp"
+#include <cstring>
+
+//–– Node ctor ––//
+// start is where the values begin: 0 for a node filled forwards by
+// push_back, kNodeCapacity for one filled backwards by push_front.
+UnrolledLinkedList::Node::Node(Node* n, unsigned short start)
+    : next(n), first(start), last(start)
+{}
+
+std::size_t UnrolledLinkedList::Node::count() const noexcept {
+    return static_cast<std::size_t>(last - first);
+}
+
+//–– dtor ––//
+UnrolledLinkedList::~UnrolledLinkedList() {
+    clear();
+}
+
+//–– pushFront ––//
+void UnrolledLinkedList::push_front(int v) {
+    if (!head || head->first == 0) {
+        head = new Node(head, static_cast<unsigned short>(kNodeCapacity));
+        if (!tail) tail = head;
+    }
+    head->values[--head->first] = v;
+    ++count;
+}
+
+//–– pushBack ––//
+void UnrolledLinkedList::push_back(int v) {
+    if (!tail || tail->last == kNodeCapacity) {
+        Node* n = new Node(nullptr, 0);
+        if (tail) tail->next = n;
+        else head = n;
+        tail = n;
+    }
+    tail->values[tail->last++] = v;
+    ++count;
+}
+
+//–– popFront ––//
+int UnrolledLinkedList::pop_front() {
+    if (empty()) {
+        throw std::underflow_error("popFront() on empty list");
+    }
+    int val = head->values[head->first++];
+    if (head->first == head->last) {
+        unlink(nullptr, head);
+    }
+    --count;
+    return val;
+}
+
+//–– popBack ––//
+int UnrolledLinkedList::pop_back() {
+    if (empty()) {
+        throw std::underflow_error("popBack() on empty list");
+    }
+    int val = tail->values[--tail->last];
+    if (tail->first == tail->last) {
+        // only an emptied tail node needs its predecessor
+        unlink(find_prev(tail), tail);
+    }
+    --count;
+    return val;
+}
+
+//–– front ––//
+int UnrolledLinkedList::front() const {
+    if (empty()) {
+        throw std::underflow_error("front() on empty list");
+    }
+    return head->values[head->first];
+}
+
+//–– back ––//
+int UnrolledLinkedList::back() const {
+    if (empty()) {
+        throw std::underflow_error("back() on empty list");
+    }
+    return tail->values[tail->last - 1];
+}
+
+//–– empty ––//
+bool UnrolledLinkedList::empty() const noexcept {
+    return head == nullptr;
+}
+
+//–– size ––//
+std::size_t UnrolledLinkedList::size() const noexcept {
+    return count;
+}
+
+//–– remove ––//
+bool UnrolledLinkedList::remove(int v) {
+    Node* prev = nullptr;
+    for (Node* p = head; p; prev = p, p = p->next) {
+        for (unsigned short i = p->first; i < p->last; ++i) {
+            if (p->values[i] != v) continue;
+
+            std::memmove(&p->values[i], &p->values[i + 1],
+                         (p->last - i - 1) * sizeof(int));
+            --p->last;
+            --count;
+
+            if (p->first == p->last) {
+                unlink(prev, p);
+            } else if (p->next && p->count() < kNodeCapacity / 2 &&
+                       p->count() + p->next->count() <= kNodeCapacity) {
+                // merge two sparse neighbours to keep nodes dense
+                Node* n = p->next;
+                std::memmove(&p->values[0], &p->values[p->first], p->count() * sizeof(int));
+                p->last = static_cast<unsigned short>(p->count());
+                p->first = 0;
+                std::memcpy(&p->values[p->last], &n->values[n->first], n->count() * sizeof(int));
+                p->last = static_cast<unsigned short>(p->last + n->count());
+                unlink(p, n);
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+//–– clear ––//
+void UnrolledLinkedList::clear() noexcept {
+    Node* p = head;
+    while (p) {
+        Node* tmp = p->next;
+        delete p;
+        p = tmp;
+    }
+    head = nullptr;
+    tail = nullptr;
+    count = 0;
+}
+
+//–– print ––//
+void UnrolledLinkedList::print() const {
+    for (Node* p = head; p; p = p->next) {
+        for (unsigned short i = p->first; i < p->last; ++i) {
+            std::cout << p->values[i] << ' ';
+        }
+    }
+    std::cout << "\n";
+}
+
+//–– helpers ––//
+UnrolledLinkedList::Node* UnrolledLinkedList::find_prev(Node* node) const noexcept {
+    if (node == head) return nullptr;
+    Node* p = head;
+    while (p->next != node) {
+        p = p->next;
+    }
+    return p;
+}
+
+// Detaches node (whose predecessor is prev, or nullptr for head) and frees it
+void UnrolledLinkedList::unlink(Node* prev, Node* node) noexcept {
+    if (prev) prev->next = node->next;
+    else head = node->next;
+    if (tail == node) tail = prev;
+    delete node;
+}
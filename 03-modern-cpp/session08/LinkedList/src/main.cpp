@@ -1,5 +1,8 @@
 #include <iostream>
+#include <thread>
 #include "LinkedList.hpp"
+#include "LockFreeQueue.hpp"
+#include "UnrolledLinkedList.hpp"
 
 int main() {
 	LinkedList ll;
@@ -15,5 +18,52 @@ int main() {
 //	int b = ll.pop_back();             // removes 20
 	ll.print();                       // prints: 10
 
+	// prev links make pop_back O(1) as well
+	DoublyLinkedList dl;
+	for (int i = 1; i <= 5; ++i)
+		dl.push_back(i);              // O(1) through the tail pointer
+	dl.pop_back();                    // O(1), no walk to the second-last node
+	std::cout << dl.back() << "\n";   // 4
+	dl.print();                       // prints: 1 2 3 4
+
+	// nodes come from a per-list pool: after warming up, a steady
+	// push/pop cycle is served entirely from the free list
+	for (int round = 0; round < 1000; ++round) {
+		dl.push_back(round);
+		dl.pop_front();
+	}
+	const auto& st = dl.allocation_stats();
+	std::cout << st.slab_allocs << " slab(s) for "
+	          << st.block_allocs << " nodes\n";  // 1 slab(s) for 1005 nodes
+
+	// same API, several values per cache-line-sized node
+	UnrolledLinkedList ul;
+	for (int i = 1; i <= 20; ++i)
+		ul.push_back(i * 10);         // spans two nodes
+	ul.push_front(5);
+	ul.remove(100);
+	// list is now: 5, 10, 20, ..., 90, 110, ..., 200
+
+	std::cout << ul.front() << "\n";  // 5
+	std::cout << ul.back()  << "\n";  // 200
+	std::cout << ul.size()  << "\n";  // 20
+	ul.print();
+
+	// thread-safe FIFO: two producers, one consumer, no locks
+	LockFreeQueue q;
+	std::thread p1([&q] { for (int i = 1; i <= 100; ++i) q.push_back(i); });
+	std::thread p2([&q] { for (int i = 1; i <= 100; ++i) q.push_back(-i); });
+	int total = 0;
+	for (int received = 0; received < 200; ) {
+		int v;
+		if (q.pop_front(v)) {
+			total += v;
+			++received;
+		}
+	}
+	p1.join();
+	p2.join();
+	std::cout << total << "\n";       // 0
+
 	return 0;
 }
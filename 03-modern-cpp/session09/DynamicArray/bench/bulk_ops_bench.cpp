@@ -0,0 +1,85 @@
+// Bulk kernels versus the element-by-element operator[] loops they
+// replace, on a large DynamicArray of sensor-like samples.
+//
+//   g++ -std=c++17 -O2 -pthread -Iinclude bench/bulk_ops_bench.cpp -o bulk_bench
+//   ./bulk_bench [elements]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <utility>
+#include "BulkOps.hpp"
+#include "DynamicArray.hpp"
+
+template <typename F>
+static double best_ms(F f, int reps = 5) {
+    double best = 1e300;
+    for (int r = 0; r < reps; ++r) {
+        auto t0 = std::chrono::steady_clock::now();
+        f();
+        auto t1 = std::chrono::steady_clock::now();
+        double ms = std::chrono::duration<double, std::milli>(t1 - t0).count();
+        if (ms < best) best = ms;
+    }
+    return best;
+}
+
+static void report(const char* what, double scalar, double simd, double par) {
+    std::printf("%-10s scalar %8.2f ms | bulk %8.2f ms (x%5.2f) | bulk::par %8.2f ms (x%5.2f)\n",
+                what, scalar, simd, scalar / simd, par, scalar / par);
+}
+
+// Keeps results alive so the optimiser cannot drop the loops
+static volatile double g_sink;
+
+template <typename T>
+static void run(const char* type, std::size_t n) {
+    DynamicArray<T> d;
+    d.resize(n);
+    for (std::size_t i = 0; i < n; ++i) d[i] = static_cast<T>((i * 2654435761u) % 1000);
+    const T needle = static_cast<T>(5000);   // absent: full scan
+    std::printf("\n%s, %zu elements\n", type, n);
+
+    report("sum",
+        best_ms([&] { bulk::detail::sum_type_t<T> s{}; for (std::size_t i = 0; i < d.size(); ++i) s += d[i]; g_sink = s; }),
+        best_ms([&] { g_sink = bulk::sum(d); }),
+        best_ms([&] { g_sink = bulk::sum(bulk::par, d); }));
+
+    report("minmax",
+        best_ms([&] {
+            T lo = d[0], hi = d[0];
+            for (std::size_t i = 1; i < d.size(); ++i) { if (d[i] < lo) lo = d[i]; if (d[i] > hi) hi = d[i]; }
+            g_sink = lo + hi; }),
+        best_ms([&] { auto m = bulk::minmax(d); g_sink = m.first + m.second; }),
+        best_ms([&] { auto m = bulk::minmax(bulk::par, d); g_sink = m.first + m.second; }));
+
+    report("find",
+        best_ms([&] { std::size_t i = 0; while (i < d.size() && d[i] != needle) ++i; g_sink = i; }),
+        best_ms([&] { g_sink = bulk::find(d, needle); }),
+        best_ms([&] { g_sink = bulk::find(bulk::par, d, needle); }));
+
+    report("transform",
+        best_ms([&] { for (std::size_t i = 0; i < d.size(); ++i) d[i] = d[i] * 3 / 2; }),
+        best_ms([&] { bulk::transform(d, [](T x) { return x * 3 / 2; }); }),
+        best_ms([&] { bulk::transform(bulk::par, d, [](T x) { return x * 3 / 2; }); }));
+
+    report("fill",
+        best_ms([&] { for (std::size_t i = 0; i < d.size(); ++i) d[i] = 7; }),
+        best_ms([&] { bulk::fill(d, T(7)); }),
+        best_ms([&] { bulk::fill(bulk::par, d, T(7)); }));
+
+    DynamicArray<T> dst;
+    report("copy_from",
+        best_ms([&] { DynamicArray<T> c(d.size()); for (std::size_t i = 0; i < d.size(); ++i) c.push_back(d[i]); g_sink = c[0]; }),
+        best_ms([&] { bulk::copy_from(dst, d); }),
+        best_ms([&] { bulk::copy_from(bulk::par, dst, d); }));
+}
+
+int main(int argc, char** argv) {
+    std::size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 16'000'000;
+    std::printf("hardware threads: %u\n", std::thread::hardware_concurrency());
+    run<int>("int", n);
+    run<float>("float", n);
+    run<double>("double", n);
+    return 0;
+}
@@ -0,0 +1,63 @@
+// Compares DynamicArray growth policies: push_back throughput, final slack
+// and peak resident memory. Each policy runs in its own child process so
+// that ru_maxrss reflects only that run.
+//
+//   g++ -std=c++17 -O2 -Iinclude bench/growth_policy_bench.cpp -o growth_bench
+//   ./growth_bench [elements]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "DynamicArray.hpp"
+
+template <typename Growth>
+static void run(const char* name, std::size_t n, int out_fd) {
+    auto t0 = std::chrono::steady_clock::now();
+    DynamicArray<int, std::allocator<int>, Growth> d;
+    for (std::size_t i = 0; i < n; ++i)
+        d.push_back(static_cast<int>(i));
+    auto t1 = std::chrono::steady_clock::now();
+
+    double secs = std::chrono::duration<double>(t1 - t0).count();
+    double slack = 100.0 * (d.capacity() - d.size()) / d.capacity();
+    char line[160];
+    int len = std::snprintf(line, sizeof line, "%-18s %10.1f Mpush/s %9.1f%% slack",
+                            name, n / secs / 1e6, slack);
+    (void)!write(out_fd, line, len);
+}
+
+template <typename Growth>
+static void measure(const char* name, std::size_t n) {
+    int fds[2];
+    if (pipe(fds) != 0) { std::perror("pipe"); std::exit(1); }
+
+    pid_t pid = fork();
+    if (pid == 0) {
+        close(fds[0]);
+        run<Growth>(name, n, fds[1]);
+        _exit(0);
+    }
+    close(fds[1]);
+
+    char line[160] = {};
+    (void)!read(fds[0], line, sizeof line - 1);
+    close(fds[0]);
+
+    int status = 0;
+    struct rusage ru {};
+    wait4(pid, &status, 0, &ru);
+    std::printf("%s %10.1f MiB peak RSS\n", line, ru.ru_maxrss / 1024.0);
+}
+
+int main(int argc, char** argv) {
+    std::size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 50'000'000;
+    std::printf("pushing %zu ints (%.1f MiB of payload)\n\n", n, n * sizeof(int) / 1048576.0);
+
+    measure<DoublingGrowth>("doubling", n);
+    measure<HalfStepGrowth>("1.5x", n);
+    measure<FixedChunkGrowth<1 << 20>>("fixed 1M chunk", n);
+    return 0;
+}
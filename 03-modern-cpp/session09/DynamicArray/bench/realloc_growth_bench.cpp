@@ -0,0 +1,79 @@
+// push_back latency distribution for a large DynamicArray<int>, growing
+// with allocate + memcpy + deallocate (std::allocator) versus in-place
+// growth through realloc/mremap (ReallocAllocator).
+//
+//   g++ -std=c++17 -O2 -Iinclude bench/realloc_growth_bench.cpp -o realloc_bench
+//   ./realloc_bench [elements]
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include "DynamicArray.hpp"
+#include "ReallocAllocator.hpp"
+
+using Clock = std::chrono::steady_clock;
+
+// log2 histogram of per-call latency in nanoseconds
+struct Histogram {
+    std::uint64_t buckets[64] = {};
+    std::uint64_t count = 0;
+    std::uint64_t max_ns = 0;
+    std::uint64_t stall_ns = 0;   // total time spent in growing calls
+    std::uint64_t stalls = 0;
+
+    void add(std::uint64_t ns) {
+        int b = 0;
+        while ((std::uint64_t(1) << (b + 1)) <= ns && b < 63) ++b;
+        ++buckets[b];
+        ++count;
+        if (ns > max_ns) max_ns = ns;
+    }
+
+    // Upper bound of the bucket holding the q-th quantile
+    std::uint64_t quantile(double q) const {
+        std::uint64_t target = static_cast<std::uint64_t>(q * count), seen = 0;
+        for (int b = 0; b < 64; ++b) {
+            seen += buckets[b];
+            if (seen > target) return std::uint64_t(1) << (b + 1);
+        }
+        return max_ns;
+    }
+};
+
+template <typename Array>
+static void run(const char* name, std::size_t n) {
+    Histogram h;
+    Array d;
+    auto start = Clock::now();
+    for (std::size_t i = 0; i < n; ++i) {
+        std::size_t cap = d.capacity();
+        auto t0 = Clock::now();
+        d.push_back(static_cast<int>(i));
+        auto t1 = Clock::now();
+        std::uint64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count();
+        h.add(ns);
+        if (d.capacity() != cap) {
+            h.stall_ns += ns;
+            ++h.stalls;
+        }
+    }
+    double total_ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+    std::printf("%-16s total %8.1f ms | p50 <%5llu ns  p99.99 <%7llu ns  max %9.1f us"
+                " | %2llu growths, %8.1f ms stalled\n",
+                name, total_ms,
+                (unsigned long long)h.quantile(0.5),
+                (unsigned long long)h.quantile(0.9999),
+                h.max_ns / 1e3,
+                (unsigned long long)h.stalls, h.stall_ns / 1e6);
+}
+
+int main(int argc, char** argv) {
+    std::size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 100'000'000;
+    std::printf("push_back of %zu ints (%.0f MiB)\n\n", n, n * sizeof(int) / 1048576.0);
+
+    run<DynamicArray<int>>("copy growth", n);
+    run<DynamicArray<int, ReallocAllocator<int>>>("realloc/mremap", n);
+    return 0;
+}
@@ -0,0 +1,59 @@
+// Heap allocations and time for many short-lived arrays whose sizes are
+// mostly below 16: DynamicArray versus SmallDynamicArray<int, 16>.
+// Global operator new/delete are replaced to count allocations.
+//
+//   g++ -std=c++17 -O2 -Iinclude bench/small_array_bench.cpp -o small_bench
+//   ./small_bench [arrays]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <random>
+#include <vector>
+#include "DynamicArray.hpp"
+#include "SmallDynamicArray.hpp"
+
+static std::size_t g_allocations = 0;
+
+void* operator new(std::size_t n) {
+    ++g_allocations;
+    if (void* p = std::malloc(n ? n : 1)) return p;
+    throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+template <typename Array>
+static void run(const char* name, const std::vector<int>& sizes) {
+    std::size_t before = g_allocations;
+    long long checksum = 0;
+
+    auto t0 = std::chrono::steady_clock::now();
+    for (int n : sizes) {
+        Array a;
+        for (int i = 0; i < n; ++i) a.push_back(i);
+        checksum += a[a.size() - 1];
+    }
+    auto t1 = std::chrono::steady_clock::now();
+
+    std::size_t allocs = g_allocations - before;
+    std::printf("%-26s %10zu allocations (%.2f per array) %8.1f ms  [%lld]\n",
+                name, allocs, double(allocs) / sizes.size(),
+                std::chrono::duration<double, std::milli>(t1 - t0).count(), checksum);
+}
+
+int main(int argc, char** argv) {
+    std::size_t arrays = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 5'000'000;
+
+    // 90% of arrays hold 1..16 elements, the rest 17..64
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> small(1, 16), large(17, 64), pick(0, 9);
+    std::vector<int> sizes(arrays);
+    for (int& n : sizes) n = pick(rng) ? small(rng) : large(rng);
+
+    std::printf("%zu arrays, 90%% with <= 16 elements\n\n", arrays);
+    run<DynamicArray<int>>("DynamicArray<int>", sizes);
+    run<SmallDynamicArray<int, 16>>("SmallDynamicArray<int,16>", sizes);
+    return 0;
+}
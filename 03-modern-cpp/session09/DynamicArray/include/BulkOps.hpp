@@ -0,0 +1,324 @@
+#ifndef INCLUDE_BULKOPS_HPP_
+#define INCLUDE_BULKOPS_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../../common/ParallelChunks.hpp"
+
+// Bulk algorithms over contiguous arrays (DynamicArray, SmallDynamicArray,
+// or anything exposing data() and size()).
+//
+// For arithmetic element types the kernels work on blocks of kLanes
+// independent accumulators, which GCC and Clang turn into SIMD code at -O2
+// (SSE/AVX on x86, NEON on ARM) without needing -ffast-math. Every
+// algorithm also takes an optional execution policy: bulk::seq (default)
+// or bulk::par, which splits large arrays across threads.
+namespace bulk {
+
+using SequentialPolicy = parallel::SequentialPolicy;
+using ParallelPolicy = parallel::BasicParallelPolicy<1 << 16>;
+
+inline constexpr SequentialPolicy seq{};
+inline constexpr ParallelPolicy par{};
+
+namespace detail {
+
+constexpr std::size_t kLanes = 16;
+
+// Integers are summed in 64 bits so that sums of int/short do not wrap
+template <typename T>
+using sum_type_t = std::conditional_t<
+    std::is_integral_v<T>,
+    std::conditional_t<std::is_signed_v<T>, long long, unsigned long long>,
+    T>;
+
+using parallel::for_each_chunk;
+using parallel::max_threads;
+
+template <typename T, typename Acc>
+Acc sum_kernel(const T* p, std::size_t n) {
+    if constexpr (std::is_arithmetic_v<T>) {
+        Acc lanes[kLanes] = {};
+        std::size_t i = 0;
+        for (; i + kLanes <= n; i += kLanes)
+            for (std::size_t j = 0; j < kLanes; ++j)
+                lanes[j] += static_cast<Acc>(p[i + j]);
+        Acc s{};
+        for (std::size_t j = 0; j < kLanes; ++j) s += lanes[j];
+        for (; i < n; ++i) s += static_cast<Acc>(p[i]);
+        return s;
+    } else {
+        Acc s{};
+        for (std::size_t i = 0; i < n; ++i) s = s + p[i];
+        return s;
+    }
+}
+
+// Expects n > 0
+template <typename T>
+std::pair<T, T> minmax_kernel(const T* p, std::size_t n) {
+    T lo = p[0], hi = p[0];
+    std::size_t i = 0;
+    if constexpr (std::is_arithmetic_v<T>) {
+        if (n >= kLanes) {
+            T lo_l[kLanes], hi_l[kLanes];
+            for (std::size_t j = 0; j < kLanes; ++j) lo_l[j] = hi_l[j] = p[j];
+            for (i = kLanes; i + kLanes <= n; i += kLanes) {
+                for (std::size_t j = 0; j < kLanes; ++j) {
+                    lo_l[j] = p[i + j] < lo_l[j] ? p[i + j] : lo_l[j];
+                    hi_l[j] = hi_l[j] < p[i + j] ? p[i + j] : hi_l[j];
+                }
+            }
+            for (std::size_t j = 0; j < kLanes; ++j) {
+                lo = lo_l[j] < lo ? lo_l[j] : lo;
+                hi = hi < hi_l[j] ? hi_l[j] : hi;
+            }
+        }
+    }
+    for (; i < n; ++i) {
+        if (p[i] < lo) lo = p[i];
+        if (hi < p[i]) hi = p[i];
+    }
+    return {lo, hi};
+}
+
+// Whether v converts to E and back unchanged. If it does not, no element
+// of type E equals v, and converting it would find the wrong one (300 as
+// a char is 44). Floating needles outside an integer E's range are
+// rejected before the conversion, which would be undefined.
+template <typename E, typename T>
+bool fits_element(const T& v) {
+    if constexpr (std::is_arithmetic_v<E> && std::is_arithmetic_v<T>) {
+        if constexpr (std::is_floating_point_v<T> && std::is_integral_v<E> &&
+                      !std::is_same_v<E, bool>) {
+            // [lowest, 2^digits) is exact in T for every integer E
+            const T lo = static_cast<T>(std::numeric_limits<E>::lowest());
+            const T hi = T(2) * static_cast<T>(std::numeric_limits<E>::max() / 2 + 1);
+            if (!(v >= lo && v < hi)) return false;
+        }
+        return static_cast<T>(static_cast<E>(v)) == v;
+    } else {
+        return true;
+    }
+}
+
+// Index of the first element equal to v in [b, e), or e. Gives up early
+// once `stop` drops to b or below (another slice already found a match).
+template <typename T>
+std::size_t find_kernel(const T* p, std::size_t b, std::size_t e, const T& v,
+                        const std::atomic<std::size_t>* stop = nullptr) {
+    std::size_t i = b;
+    if constexpr (std::is_arithmetic_v<T>) {
+        // Test a whole block branch-free, then locate the hit within it
+        for (; i + kLanes <= e; i += kLanes) {
+            bool hit = false;
+            for (std::size_t j = 0; j < kLanes; ++j) hit |= (p[i + j] == v);
+            if (hit) break;
+            if (stop && ((i - b) & 0xFFFF) == 0 && stop->load(std::memory_order_relaxed) <= b)
+                return e;
+        }
+    }
+    for (; i < e; ++i)
+        if (p[i] == v) return i;
+    return e;
+}
+
+} // namespace detail
+
+//–– sum ––//
+
+template <typename Array>
+auto sum(const SequentialPolicy&, const Array& a) {
+    using T = std::remove_cv_t<std::remove_reference_t<decltype(a[0])>>;
+    return detail::sum_kernel<T, detail::sum_type_t<T>>(a.data(), a.size());
+}
+
+template <typename Array>
+auto sum(const ParallelPolicy& pol, const Array& a) {
+    using T = std::remove_cv_t<std::remove_reference_t<decltype(a[0])>>;
+    using Acc = detail::sum_type_t<T>;
+
+    std::vector<Acc> partial(detail::max_threads(pol));
+    const T* p = a.data();
+    std::size_t chunks = detail::for_each_chunk(pol, a.size(),
+        [&](std::size_t b, std::size_t e, std::size_t c) {
+            partial[c] = detail::sum_kernel<T, Acc>(p + b, e - b);
+        });
+    Acc s{};
+    for (std::size_t c = 0; c < chunks; ++c) s += partial[c];
+    return s;
+}
+
+template <typename Array>
+auto sum(const Array& a) {
+    return sum(seq, a);
+}
+
+//–– minmax ––//
+
+// Smallest and largest element; throws on an empty array
+template <typename Array>
+auto minmax(const SequentialPolicy&, const Array& a) {
+    if (a.size() == 0) throw std::underflow_error("minmax() on empty array");
+    return detail::minmax_kernel(a.data(), a.size());
+}
+
+template <typename Array>
+auto minmax(const ParallelPolicy& pol, const Array& a) {
+    using T = std::remove_cv_t<std::remove_reference_t<decltype(a[0])>>;
+    if (a.size() == 0) throw std::underflow_error("minmax() on empty array");
+
+    std::vector<std::pair<T, T>> partial(detail::max_threads(pol), std::pair<T, T>(a[0], a[0]));
+    const T* p = a.data();
+    std::size_t chunks = detail::for_each_chunk(pol, a.size(),
+        [&](std::size_t b, std::size_t e, std::size_t c) {
+            partial[c] = detail::minmax_kernel(p + b, e - b);
+        });
+    std::pair<T, T> r = partial[0];
+    for (std::size_t c = 1; c < chunks; ++c) {
+        if (partial[c].first < r.first) r.first = partial[c].first;
+        if (r.second < partial[c].second) r.second = partial[c].second;
+    }
+    return r;
+}
+
+template <typename Array>
+auto minmax(const Array& a) {
+    return minmax(seq, a);
+}
+
+//–– find ––//
+
+// Index of the first element equal to v, or a.size() if there is none
+template <typename Array, typename T>
+std::size_t find(const SequentialPolicy&, const Array& a, const T& v) {
+    using E = std::remove_cv_t<std::remove_reference_t<decltype(a[0])>>;
+    if (!detail::fits_element<E>(v)) return a.size();
+    return detail::find_kernel<E>(a.data(), 0, a.size(), static_cast<E>(v));
+}
+
+template <typename Array, typename T>
+std::size_t find(const ParallelPolicy& pol, const Array& a, const T& v) {
+    using E = std::remove_cv_t<std::remove_reference_t<decltype(a[0])>>;
+    if (!detail::fits_element<E>(v)) return a.size();
+    const E* p = a.data();
+    const E value = static_cast<E>(v);
+    std::atomic<std::size_t> best{a.size()};
+
+    detail::for_each_chunk(pol, a.size(),
+        [&](std::size_t b, std::size_t e, std::size_t) {
+            std::size_t i = detail::find_kernel<E>(p, b, e, value, &best);
+            if (i == e) return;
+            std::size_t cur = best.load(std::memory_order_relaxed);
+            while (i < cur && !best.compare_exchange_weak(cur, i, std::memory_order_relaxed)) {}
+        });
+    return best.load(std::memory_order_relaxed);
+}
+
+template <typename Array, typename T>
+std::size_t find(const Array& a, const T& v) {
+    return find(seq, a, v);
+}
+
+//–– transform ––//
+
+// Replaces every element x with op(x)
+template <typename Array, typename Op>
+void transform(const SequentialPolicy&, Array& a, Op op) {
+    auto* p = a.data();
+    const std::size_t n = a.size();
+    for (std::size_t i = 0; i < n; ++i) p[i] = op(p[i]);
+}
+
+template <typename Array, typename Op>
+void transform(const ParallelPolicy& pol, Array& a, Op op) {
+    auto* p = a.data();
+    detail::for_each_chunk(pol, a.size(),
+        [&](std::size_t b, std::size_t e, std::size_t) {
+            for (std::size_t i = b; i < e; ++i) p[i] = op(p[i]);
+        });
+}
+
+template <typename Array, typename Op>
+void transform(Array& a, Op op) {
+    transform(seq, a, op);
+}
+
+//–– fill ––//
+
+template <typename Array, typename T>
+void fill(const SequentialPolicy&, Array& a, const T& v) {
+    std::fill(a.data(), a.data() + a.size(), v);
+}
+
+template <typename Array, typename T>
+void fill(const ParallelPolicy& pol, Array& a, const T& v) {
+    auto* p = a.data();
+    detail::for_each_chunk(pol, a.size(),
+        [&](std::size_t b, std::size_t e, std::size_t) {
+            std::fill(p + b, p + e, v);
+        });
+}
+
+template <typename Array, typename T>
+void fill(Array& a, const T& v) {
+    fill(seq, a, v);
+}
+
+//–– copy_from ––//
+
+// Makes a hold exactly the n elements at src
+template <typename Array, typename T>
+void copy_from(const SequentialPolicy&, Array& a, const T* src, std::size_t n) {
+    static_assert(std::is_same_v<std::remove_reference_t<decltype(a[0])>, T>,
+                  "copy_from() needs matching element types");
+    a.resize(n);
+    if constexpr (std::is_trivially_copyable_v<T>) {
+        if (n) std::memcpy(a.data(), src, n * sizeof(T));
+    } else {
+        std::copy(src, src + n, a.data());
+    }
+}
+
+template <typename Array, typename T>
+void copy_from(const ParallelPolicy& pol, Array& a, const T* src, std::size_t n) {
+    static_assert(std::is_same_v<std::remove_reference_t<decltype(a[0])>, T>,
+                  "copy_from() needs matching element types");
+    a.resize(n);
+    T* dst = a.data();
+    detail::for_each_chunk(pol, n,
+        [&](std::size_t b, std::size_t e, std::size_t) {
+            if constexpr (std::is_trivially_copyable_v<T>)
+                std::memcpy(dst + b, src + b, (e - b) * sizeof(T));
+            else
+                std::copy(src + b, src + e, dst + b);
+        });
+}
+
+template <typename Array, typename T>
+void copy_from(Array& a, const T* src, std::size_t n) {
+    copy_from(seq, a, src, n);
+}
+
+template <typename Policy, typename Array, typename Source,
+          typename = decltype(std::declval<const Source&>().data())>
+void copy_from(const Policy& pol, Array& a, const Source& src) {
+    copy_from(pol, a, src.data(), src.size());
+}
+
+template <typename Array, typename Source,
+          typename = decltype(std::declval<const Source&>().data())>
+void copy_from(Array& a, const Source& src) {
+    copy_from(seq, a, src.data(), src.size());
+}
+
+} // namespace bulk
+
+#endif // INCLUDE_BULKOPS_HPP_
@@ -4,33 +4,497 @@
 #include <iostream>
 #include <cstring>
 #include <algorithm>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
 #include <utility>
 
+#include "GrowthPolicy.hpp"
+
+namespace detail {
+
+// True when Alloc can resize a block in place via reallocate(p, old_n, new_n)
+template <typename Alloc, typename T, typename = void>
+struct has_reallocate : std::false_type {};
+
+template <typename Alloc, typename T>
+struct has_reallocate<Alloc, T, std::void_t<decltype(std::declval<Alloc&>().reallocate(
+    std::declval<T*>(), std::size_t{}, std::size_t{}))>> : std::true_type {};
+
+} // namespace detail
+
+template <typename T, typename Alloc = std::allocator<T>, typename Growth = DoublingGrowth>
 class DynamicArray {
 
+    using alloc_traits = std::allocator_traits<Alloc>;
+
+    // Trivially copyable elements may be moved by the allocator itself
+    // (realloc/mremap) instead of allocate + memcpy + deallocate.
+    static constexpr bool can_reallocate =
+        std::is_trivially_copyable_v<T> && detail::has_reallocate<Alloc, T>::value;
+
 public:
+    using value_type     = T;
+    using allocator_type = Alloc;
+    using growth_policy  = Growth;
+    using size_type      = std::size_t;
+    using iterator       = T*;
+    using const_iterator = T const*;
 
-    DynamicArray(std::size_t cap);
+    DynamicArray(std::size_t cap = 0, const Alloc& alloc = Alloc());
     DynamicArray(const DynamicArray& other);
-    DynamicArray(DynamicArray&& other);
+    DynamicArray(DynamicArray&& other) noexcept;
     DynamicArray& operator=(const DynamicArray& other);
-    DynamicArray& operator=(DynamicArray&& other);
+    DynamicArray& operator=(DynamicArray&& other) noexcept(
+        alloc_traits::propagate_on_container_move_assignment::value ||
+        alloc_traits::is_always_equal::value);
     ~DynamicArray();
 
-    void push_back(int v);
+    void push_back(const T& v);
+    void push_back(T&& v);
 
-    int& operator[](std::size_t i);
-    int const& operator[](std::size_t i) const;
+    // Constructs a new element in place at the end, growing if needed
+    template <typename... Args>
+    T& emplace_back(Args&&... args);
+
+    // Grows capacity to at least new_cap; never shrinks
+    void reserve(std::size_t new_cap);
+    // Releases unused capacity so that capacity() == size()
+    void shrink_to_fit();
+    // Grows with value-initialised (or copied) elements, or destroys the tail
+    void resize(std::size_t new_size);
+    void resize(std::size_t new_size, const T& value);
+
+    T& operator[](std::size_t i);
+    T const& operator[](std::size_t i) const;
+
+    T* data() noexcept;
+    T const* data() const noexcept;
+
+    iterator begin() noexcept;
+    iterator end() noexcept;
+    const_iterator begin() const noexcept;
+    const_iterator end() const noexcept;
 
     std::size_t size() const noexcept;
     std::size_t capacity() const noexcept;
 
+    allocator_type get_allocator() const noexcept;
+
 private:
-    int* data_;
+    Alloc alloc_;
+    T* data_;
     std::size_t size_;
     std::size_t cap_;
 
-    void reserve(std::size_t new_cap);
+    std::size_t next_capacity(std::size_t min_cap) const;
+    void reallocate(std::size_t new_cap);
+    void destroy_tail(std::size_t new_size) noexcept;
+    template <typename... Args>
+    void grow_to(std::size_t new_size, const Args&... args);
+
+    T* allocate(std::size_t n);
+    void deallocate(T* p, std::size_t n) noexcept;
+    void destroy_all() noexcept;
+
+    // Moves (or copies) n live elements from src into raw storage at dst.
+    // On return the objects at src have been destroyed.
+    void relocate(T* src, std::size_t n, T* dst);
+    // Copy-constructs n elements from src into raw storage at dst.
+    void copy_construct(T const* src, std::size_t n, T* dst);
 };
 
+//–– construction / destruction ––//
+
+template <typename T, typename Alloc, typename Growth>
+DynamicArray<T, Alloc, Growth>::DynamicArray(std::size_t cap, const Alloc& alloc)
+  : alloc_(alloc)
+  , data_(nullptr)
+  , size_(0)
+  , cap_(0)
+{
+    data_ = allocate(cap);
+    cap_ = cap;
+}
+
+template <typename T, typename Alloc, typename Growth>
+DynamicArray<T, Alloc, Growth>::DynamicArray(const DynamicArray& other)
+  : alloc_(alloc_traits::select_on_container_copy_construction(other.alloc_))
+  , data_(nullptr)
+  , size_(0)
+  , cap_(0)
+{
+    data_ = allocate(other.cap_);
+    cap_ = other.cap_;
+    try {
+        copy_construct(other.data_, other.size_, data_);
+    } catch (...) {
+        deallocate(data_, cap_);
+        throw;
+    }
+    size_ = other.size_;
+}
+
+template <typename T, typename Alloc, typename Growth>
+DynamicArray<T, Alloc, Growth>::DynamicArray(DynamicArray&& other) noexcept
+  : alloc_(std::move(other.alloc_))
+  , data_(std::exchange(other.data_, nullptr))
+  , size_(std::exchange(other.size_, 0))
+  , cap_(std::exchange(other.cap_, 0))
+{}
+
+template <typename T, typename Alloc, typename Growth>
+DynamicArray<T, Alloc, Growth>& DynamicArray<T, Alloc, Growth>::operator=(const DynamicArray& other)
+{
+    if (this == &other) return *this;
+
+    Alloc new_alloc = alloc_traits::propagate_on_container_copy_assignment::value
+                    ? other.alloc_ : alloc_;
+
+    T* tmp = alloc_traits::allocate(new_alloc, other.cap_);
+    try {
+        if constexpr (std::is_trivially_copyable_v<T>) {
+            if (other.size_) std::memcpy(tmp, other.data_, other.size_ * sizeof(T));
+        } else {
+            std::size_t i = 0;
+            try {
+                for (; i < other.size_; ++i)
+                    alloc_traits::construct(new_alloc, tmp + i, other.data_[i]);
+            } catch (...) {
+                for (std::size_t j = 0; j < i; ++j)
+                    alloc_traits::destroy(new_alloc, tmp + j);
+                throw;
+            }
+        }
+    } catch (...) {
+        alloc_traits::deallocate(new_alloc, tmp, other.cap_);
+        throw;
+    }
+
+    destroy_all();
+    deallocate(data_, cap_);
+    alloc_ = std::move(new_alloc);
+    data_ = tmp;
+    size_ = other.size_;
+    cap_ = other.cap_;
+
+    return *this;
+}
+
+template <typename T, typename Alloc, typename Growth>
+DynamicArray<T, Alloc, Growth>& DynamicArray<T, Alloc, Growth>::operator=(DynamicArray&& other) noexcept(
+    alloc_traits::propagate_on_container_move_assignment::value ||
+    alloc_traits::is_always_equal::value)
+{
+    if (this == &other) return *this;
+
+    if constexpr (!alloc_traits::propagate_on_container_move_assignment::value &&
+                  !alloc_traits::is_always_equal::value) {
+        // Storage owned by an unequal allocator cannot be adopted: move the
+        // elements one by one into memory from our own allocator instead.
+        if (alloc_ != other.alloc_) {
+            T* tmp = allocate(other.cap_);
+            relocate(other.data_, other.size_, tmp);
+            destroy_all();
+            deallocate(data_, cap_);
+            data_ = tmp;
+            size_ = std::exchange(other.size_, 0);
+            cap_ = other.cap_;
+            return *this;
+        }
+    }
+
+    destroy_all();
+    deallocate(data_, cap_);
+    if constexpr (alloc_traits::propagate_on_container_move_assignment::value) {
+        alloc_ = std::move(other.alloc_);
+    }
+    data_ = std::exchange(other.data_, nullptr);
+    size_ = std::exchange(other.size_, 0);
+    cap_ = std::exchange(other.cap_, 0);
+
+    return *this;
+}
+
+template <typename T, typename Alloc, typename Growth>
+DynamicArray<T, Alloc, Growth>::~DynamicArray() {
+    destroy_all();
+    deallocate(data_, cap_);
+}
+
+//–– element insertion ––//
+
+template <typename T, typename Alloc, typename Growth>
+void DynamicArray<T, Alloc, Growth>::push_back(const T& v) {
+    emplace_back(v);
+}
+
+template <typename T, typename Alloc, typename Growth>
+void DynamicArray<T, Alloc, Growth>::push_back(T&& v) {
+    emplace_back(std::move(v));
+}
+
+template <typename T, typename Alloc, typename Growth>
+template <typename... Args>
+T& DynamicArray<T, Alloc, Growth>::emplace_back(Args&&... args) {
+    if (size_ < cap_) {
+        alloc_traits::construct(alloc_, data_ + size_, std::forward<Args>(args)...);
+        return data_[size_++];
+    }
+
+    if constexpr (can_reallocate) {
+        // args may alias an element of the block being resized
+        T value(std::forward<Args>(args)...);
+        reallocate(next_capacity(size_ + 1));
+        alloc_traits::construct(alloc_, data_ + size_, value);
+        return data_[size_++];
+    }
+
+    // Growing: build the new element first, since args may alias an
+    // element that is about to be relocated out of the old block.
+    std::size_t new_cap = next_capacity(size_ + 1);
+    T* tmp = alloc_traits::allocate(alloc_, new_cap);
+    try {
+        alloc_traits::construct(alloc_, tmp + size_, std::forward<Args>(args)...);
+    } catch (...) {
+        deallocate(tmp, new_cap);
+        throw;
+    }
+    try {
+        relocate(data_, size_, tmp);
+    } catch (...) {
+        alloc_traits::destroy(alloc_, tmp + size_);
+        deallocate(tmp, new_cap);
+        throw;
+    }
+    deallocate(data_, cap_);
+    data_ = tmp;
+    cap_ = new_cap;
+    return data_[size_++];
+}
+
+//–– access ––//
+
+template <typename T, typename Alloc, typename Growth>
+T& DynamicArray<T, Alloc, Growth>::operator[](std::size_t i) {
+    return data_[i];
+}
+
+template <typename T, typename Alloc, typename Growth>
+T const& DynamicArray<T, Alloc, Growth>::operator[](std::size_t i) const {
+    return data_[i];
+}
+
+template <typename T, typename Alloc, typename Growth>
+T* DynamicArray<T, Alloc, Growth>::data() noexcept {
+    return data_;
+}
+
+template <typename T, typename Alloc, typename Growth>
+T const* DynamicArray<T, Alloc, Growth>::data() const noexcept {
+    return data_;
+}
+
+template <typename T, typename Alloc, typename Growth>
+typename DynamicArray<T, Alloc, Growth>::iterator DynamicArray<T, Alloc, Growth>::begin() noexcept {
+    return data_;
+}
+
+template <typename T, typename Alloc, typename Growth>
+typename DynamicArray<T, Alloc, Growth>::iterator DynamicArray<T, Alloc, Growth>::end() noexcept {
+    return data_ + size_;
+}
+
+template <typename T, typename Alloc, typename Growth>
+typename DynamicArray<T, Alloc, Growth>::const_iterator DynamicArray<T, Alloc, Growth>::begin() const noexcept {
+    return data_;
+}
+
+template <typename T, typename Alloc, typename Growth>
+typename DynamicArray<T, Alloc, Growth>::const_iterator DynamicArray<T, Alloc, Growth>::end() const noexcept {
+    return data_ + size_;
+}
+
+template <typename T, typename Alloc, typename Growth>
+std::size_t DynamicArray<T, Alloc, Growth>::size() const noexcept {
+    return size_;
+}
+
+template <typename T, typename Alloc, typename Growth>
+std::size_t DynamicArray<T, Alloc, Growth>::capacity() const noexcept {
+    return cap_;
+}
+
+template <typename T, typename Alloc, typename Growth>
+typename DynamicArray<T, Alloc, Growth>::allocator_type DynamicArray<T, Alloc, Growth>::get_allocator() const noexcept {
+    return alloc_;
+}
+
+//–– storage management ––//
+
+template <typename T, typename Alloc, typename Growth>
+void DynamicArray<T, Alloc, Growth>::reserve(std::size_t new_cap) {
+    if (new_cap <= cap_) return;
+    if (new_cap > alloc_traits::max_size(alloc_))
+        throw std::length_error("DynamicArray::reserve: capacity too large");
+    reallocate(new_cap);
+}
+
+template <typename T, typename Alloc, typename Growth>
+void DynamicArray<T, Alloc, Growth>::shrink_to_fit() {
+    if (size_ == cap_) return;
+    if (size_ == 0) {
+        deallocate(data_, cap_);
+        data_ = nullptr;
+        cap_ = 0;
+        return;
+    }
+    reallocate(size_);
+}
+
+template <typename T, typename Alloc, typename Growth>
+void DynamicArray<T, Alloc, Growth>::resize(std::size_t new_size) {
+    if (new_size <= size_) {
+        destroy_tail(new_size);
+        return;
+    }
+    grow_to(new_size);
+}
+
+template <typename T, typename Alloc, typename Growth>
+void DynamicArray<T, Alloc, Growth>::resize(std::size_t new_size, const T& value) {
+    if (new_size <= size_) {
+        destroy_tail(new_size);
+        return;
+    }
+    if (new_size > cap_ && &value >= data_ && &value < data_ + size_) {
+        // value lives in our storage and would dangle after reallocation
+        T copy(value);
+        grow_to(new_size, copy);
+        return;
+    }
+    grow_to(new_size, value);
+}
+
+template <typename T, typename Alloc, typename Growth>
+template <typename... Args>
+void DynamicArray<T, Alloc, Growth>::grow_to(std::size_t new_size, const Args&... args) {
+    if (new_size > cap_)
+        reserve(next_capacity(new_size));
+
+    std::size_t i = size_;
+    try {
+        for (; i < new_size; ++i)
+            alloc_traits::construct(alloc_, data_ + i, args...);
+    } catch (...) {
+        for (std::size_t j = size_; j < i; ++j)
+            alloc_traits::destroy(alloc_, data_ + j);
+        throw;
+    }
+    size_ = new_size;
+}
+
+template <typename T, typename Alloc, typename Growth>
+void DynamicArray<T, Alloc, Growth>::reallocate(std::size_t new_cap) {
+    if constexpr (can_reallocate) {
+        if (data_) {
+            data_ = alloc_.reallocate(data_, cap_, new_cap);
+            cap_ = new_cap;
+            return;
+        }
+    }
+
+    T* tmp = allocate(new_cap);
+    try {
+        relocate(data_, size_, tmp);
+    } catch (...) {
+        deallocate(tmp, new_cap);
+        throw;
+    }
+    deallocate(data_, cap_);
+    data_ = tmp;
+    cap_ = new_cap;
+}
+
+template <typename T, typename Alloc, typename Growth>
+std::size_t DynamicArray<T, Alloc, Growth>::next_capacity(std::size_t min_cap) const {
+    std::size_t n = Growth::next(cap_, min_cap);
+    if (n < min_cap || n > alloc_traits::max_size(alloc_))
+        throw std::length_error("DynamicArray: capacity overflow");
+    return n;
+}
+
+template <typename T, typename Alloc, typename Growth>
+void DynamicArray<T, Alloc, Growth>::destroy_tail(std::size_t new_size) noexcept {
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+        for (std::size_t i = new_size; i < size_; ++i)
+            alloc_traits::destroy(alloc_, data_ + i);
+    }
+    size_ = new_size;
+}
+
+template <typename T, typename Alloc, typename Growth>
+T* DynamicArray<T, Alloc, Growth>::allocate(std::size_t n) {
+    return n ? alloc_traits::allocate(alloc_, n) : nullptr;
+}
+
+template <typename T, typename Alloc, typename Growth>
+void DynamicArray<T, Alloc, Growth>::deallocate(T* p, std::size_t n) noexcept {
+    if (p) alloc_traits::deallocate(alloc_, p, n);
+}
+
+template <typename T, typename Alloc, typename Growth>
+void DynamicArray<T, Alloc, Growth>::destroy_all() noexcept {
+    destroy_tail(0);
+}
+
+template <typename T, typename Alloc, typename Growth>
+void DynamicArray<T, Alloc, Growth>::relocate(T* src, std::size_t n, T* dst) {
+    if (n == 0) return;
+
+    if constexpr (std::is_trivially_copyable_v<T>) {
+        std::memcpy(static_cast<void*>(dst), src, n * sizeof(T));
+    } else {
+        // Move only when it cannot throw (or when copying is impossible);
+        // otherwise copy so the source stays intact if a constructor throws.
+        constexpr bool use_move = std::is_nothrow_move_constructible_v<T> ||
+                                  !std::is_copy_constructible_v<T>;
+        std::size_t i = 0;
+        try {
+            for (; i < n; ++i) {
+                if constexpr (use_move)
+                    alloc_traits::construct(alloc_, dst + i, std::move(src[i]));
+                else
+                    alloc_traits::construct(alloc_, dst + i, src[i]);
+            }
+        } catch (...) {
+            for (std::size_t j = 0; j < i; ++j)
+                alloc_traits::destroy(alloc_, dst + j);
+            throw;
+        }
+        for (std::size_t j = 0; j < n; ++j)
+            alloc_traits::destroy(alloc_, src + j);
+    }
+}
+
+template <typename T, typename Alloc, typename Growth>
+void DynamicArray<T, Alloc, Growth>::copy_construct(T const* src, std::size_t n, T* dst) {
+    if (n == 0) return;
+
+    if constexpr (std::is_trivially_copyable_v<T>) {
+        std::memcpy(static_cast<void*>(dst), src, n * sizeof(T));
+    } else {
+        std::size_t i = 0;
+        try {
+            for (; i < n; ++i)
+                alloc_traits::construct(alloc_, dst + i, src[i]);
+        } catch (...) {
+            for (std::size_t j = 0; j < i; ++j)
+                alloc_traits::destroy(alloc_, dst + j);
+            throw;
+        }
+    }
+}
+
 #endif // INCLUDE_DYNAMICARRAY_HPP_
@@ -0,0 +1,39 @@
+#ifndef INCLUDE_GROWTHPOLICY_HPP_
+#define INCLUDE_GROWTHPOLICY_HPP_
+
+#include <cstddef>
+
+// Growth policies decide the next capacity when a container runs out of
+// room. next(cap, min_cap) must return a value >= min_cap.
+
+/// Doubles the capacity: fewest reallocations, up to 50% slack.
+struct DoublingGrowth {
+    static std::size_t next(std::size_t cap, std::size_t min_cap) noexcept {
+        std::size_t n = cap ? cap * 2 : 1;
+        return n < min_cap ? min_cap : n;
+    }
+};
+
+/// Grows by 1.5x: about a third of the slack of doubling, and freed blocks
+/// can eventually be reused by later growth steps.
+struct HalfStepGrowth {
+    static std::size_t next(std::size_t cap, std::size_t min_cap) noexcept {
+        std::size_t n = cap + cap / 2;
+        if (n <= cap) n = cap + 1;
+        return n < min_cap ? min_cap : n;
+    }
+};
+
+/// Grows by a constant number of elements: bounded slack, linear number
+/// of reallocations. Suited for buffers whose final size is roughly known.
+template <std::size_t Chunk>
+struct FixedChunkGrowth {
+    static_assert(Chunk > 0, "FixedChunkGrowth needs a non-zero chunk");
+
+    static std::size_t next(std::size_t cap, std::size_t min_cap) noexcept {
+        std::size_t n = cap + Chunk;
+        return n < min_cap ? min_cap : n;
+    }
+};
+
+#endif // INCLUDE_GROWTHPOLICY_HPP_
@@ -0,0 +1,115 @@
+#ifndef INCLUDE_REALLOCALLOCATOR_HPP_
+#define INCLUDE_REALLOCALLOCATOR_HPP_
+
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+// Allocator for trivially copyable element types that can grow a block
+// in place. Small blocks come from malloc and grow with realloc; on Linux,
+// blocks of at least kMapThreshold bytes are anonymous mappings grown with
+// mremap, so the kernel moves page table entries instead of copying data.
+//
+// DynamicArray detects reallocate() and uses it instead of
+// allocate + memcpy + deallocate whenever T is trivially copyable.
+template <typename T>
+struct ReallocAllocator {
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "ReallocAllocator moves elements bytewise");
+
+    using value_type = T;
+    using is_always_equal = std::true_type;
+
+    static constexpr std::size_t kMapThreshold = std::size_t(1) << 20;
+
+    ReallocAllocator() = default;
+    template <typename U>
+    ReallocAllocator(const ReallocAllocator<U>&) noexcept {}
+
+    T* allocate(std::size_t n) {
+        std::size_t bytes = n * sizeof(T);
+        void* p = is_mapped(bytes) ? map(bytes) : std::malloc(bytes);
+        if (!p) throw std::bad_alloc();
+        return static_cast<T*>(p);
+    }
+
+    void deallocate(T* p, std::size_t n) noexcept {
+        std::size_t bytes = n * sizeof(T);
+        if (is_mapped(bytes))
+            unmap(p, bytes);
+        else
+            std::free(p);
+    }
+
+    // Resizes the block at p from old_n to new_n elements, keeping the
+    // first min(old_n, new_n) of them. On failure p is left untouched.
+    T* reallocate(T* p, std::size_t old_n, std::size_t new_n) {
+        std::size_t old_bytes = old_n * sizeof(T);
+        std::size_t new_bytes = new_n * sizeof(T);
+        bool old_mapped = is_mapped(old_bytes);
+        bool new_mapped = is_mapped(new_bytes);
+
+        void* q = nullptr;
+        if (!old_mapped && !new_mapped) {
+            q = std::realloc(p, new_bytes);
+        }
+#ifdef __linux__
+        else if (old_mapped && new_mapped) {
+            q = mremap(p, page_round(old_bytes), page_round(new_bytes), MREMAP_MAYMOVE);
+            if (q == MAP_FAILED) q = nullptr;
+        }
+#endif
+        else {
+            // Crossing the threshold: the two kinds of block cannot be
+            // converted into each other, so fall back to copying.
+            q = new_mapped ? map(new_bytes) : std::malloc(new_bytes);
+            if (q) {
+                std::memcpy(q, p, old_bytes < new_bytes ? old_bytes : new_bytes);
+                deallocate(p, old_n);
+            }
+        }
+        if (!q) throw std::bad_alloc();
+        return static_cast<T*>(q);
+    }
+
+    template <typename U>
+    bool operator==(const ReallocAllocator<U>&) const noexcept { return true; }
+    template <typename U>
+    bool operator!=(const ReallocAllocator<U>&) const noexcept { return false; }
+
+private:
+#ifdef __linux__
+    static bool is_mapped(std::size_t bytes) noexcept {
+        return bytes >= kMapThreshold;
+    }
+
+    static std::size_t page_round(std::size_t bytes) noexcept {
+        static const std::size_t page = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+        return (bytes + page - 1) & ~(page - 1);
+    }
+
+    static void* map(std::size_t bytes) noexcept {
+        void* p = mmap(nullptr, page_round(bytes), PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        return p == MAP_FAILED ? nullptr : p;
+    }
+
+    static void unmap(void* p, std::size_t bytes) noexcept {
+        munmap(p, page_round(bytes));
+    }
+#else
+    static bool is_mapped(std::size_t) noexcept { return false; }
+    static void* map(std::size_t) noexcept { return nullptr; }
+    static void unmap(void*, std::size_t) noexcept {}
+#endif
+};
+
+#endif // INCLUDE_REALLOCALLOCATOR_HPP_
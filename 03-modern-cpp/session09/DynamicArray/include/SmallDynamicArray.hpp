@@ -0,0 +1,487 @@
+#ifndef INCLUDE_SMALLDYNAMICARRAY_HPP_
+#define INCLUDE_SMALLDYNAMICARRAY_HPP_
+
+#include <cstring>
+#include <algorithm>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "GrowthPolicy.hpp"
+
+// DynamicArray variant that keeps its first N elements inside the object
+// and only touches the heap once it grows beyond that. Moving an inline
+// array moves the elements one by one; moving a spilled array steals the
+// heap block. A moved-from array is empty with its inline capacity N.
+template <typename T, std::size_t N, typename Alloc = std::allocator<T>,
+          typename Growth = DoublingGrowth>
+class SmallDynamicArray {
+    static_assert(N > 0, "SmallDynamicArray needs at least one inline slot");
+
+    using alloc_traits = std::allocator_traits<Alloc>;
+
+public:
+    using value_type     = T;
+    using allocator_type = Alloc;
+    using growth_policy  = Growth;
+    using size_type      = std::size_t;
+    using iterator       = T*;
+    using const_iterator = T const*;
+
+    static constexpr std::size_t inline_capacity = N;
+
+    SmallDynamicArray(std::size_t cap = 0, const Alloc& alloc = Alloc());
+    SmallDynamicArray(const SmallDynamicArray& other);
+    SmallDynamicArray(SmallDynamicArray&& other) noexcept(std::is_nothrow_move_constructible_v<T>);
+    SmallDynamicArray& operator=(const SmallDynamicArray& other);
+    SmallDynamicArray& operator=(SmallDynamicArray&& other) noexcept(
+        std::is_nothrow_move_constructible_v<T> &&
+        (alloc_traits::propagate_on_container_move_assignment::value ||
+         alloc_traits::is_always_equal::value));
+    ~SmallDynamicArray();
+
+    void push_back(const T& v);
+    void push_back(T&& v);
+
+    template <typename... Args>
+    T& emplace_back(Args&&... args);
+
+    void reserve(std::size_t new_cap);
+    // Moves the elements back inline when they fit, else trims the heap block
+    void shrink_to_fit();
+    void resize(std::size_t new_size);
+    void resize(std::size_t new_size, const T& value);
+    void clear() noexcept;
+
+    T& operator[](std::size_t i);
+    T const& operator[](std::size_t i) const;
+
+    T* data() noexcept;
+    T const* data() const noexcept;
+
+    iterator begin() noexcept;
+    iterator end() noexcept;
+    const_iterator begin() const noexcept;
+    const_iterator end() const noexcept;
+
+    std::size_t size() const noexcept;
+    std::size_t capacity() const noexcept;
+    // True while the elements still live in the inline buffer
+    bool is_inline() const noexcept;
+
+    allocator_type get_allocator() const noexcept;
+
+private:
+    alignas(T) unsigned char inline_[N * sizeof(T)];
+    Alloc alloc_;
+    T* data_;
+    std::size_t size_;
+    std::size_t cap_;
+
+    T* inline_data() noexcept;
+    std::size_t next_capacity(std::size_t min_cap) const;
+    void reallocate(std::size_t new_cap);
+    void release_heap() noexcept;
+    void steal(SmallDynamicArray& other) noexcept(std::is_nothrow_move_constructible_v<T>);
+    template <typename... Args>
+    void grow_to(std::size_t new_size, const Args&... args);
+
+    void relocate(T* src, std::size_t n, T* dst);
+    void copy_construct(T const* src, std::size_t n, T* dst);
+};
+
+//–– construction / destruction ––//
+
+template <typename T, std::size_t N, typename Alloc, typename Growth>
+SmallDynamicArray<T, N, Alloc, Growth>::SmallDynamicArray(std::size_t cap, const Alloc& alloc)
+  : alloc_(alloc)
+  , data_(inline_data())
+  , size_(0)
+  , cap_(N)
+{
+    reserve(cap);
+}
+
+template <typename T, std::size_t N, typename Alloc, typename Growth>
+SmallDynamicArray<T, N, Alloc, Growth>::SmallDynamicArray(const SmallDynamicArray& other)
+  : alloc_(alloc_traits::select_on_container_copy_construction(other.alloc_))
+  , data_(inline_data())
+  , size_(0)
+  , cap_(N)
+{
+    reserve(other.size_);
+    try {
+        copy_construct(other.data_, other.size_, data_);
+    } catch (...) {
+        release_heap();
+        throw;
+    }
+    size_ = other.size_;
+}
+
+template <typename T, std::size_t N, typename Alloc, typename Growth>
+SmallDynamicArray<T, N, Alloc, Growth>::SmallDynamicArray(SmallDynamicArray&& other)
+    noexcept(std::is_nothrow_move_constructible_v<T>)
+  : alloc_(std::move(other.alloc_))
+  , data_(inline_data())
+  , size_(0)
+  , cap_(N)
+{
+    steal(other);
+}
+
+template <typename T, std::size_t N, typename Alloc, typename Growth>
+SmallDynamicArray<T, N, Alloc, Growth>&
+SmallDynamicArray<T, N, Alloc, Growth>::operator=(const SmallDynamicArray& other)
+{
+    if (this == &other) return *this;
+
+    clear();
+    if constexpr (alloc_traits::propagate_on_container_copy_assignment::value) {
+        if (alloc_ != other.alloc_) release_heap();
+        alloc_ = other.alloc_;
+    }
+    reserve(other.size_);
+    copy_construct(other.data_, other.size_, data_);
+    size_ = other.size_;
+
+    return *this;
+}
+
+template <typename T, std::size_t N, typename Alloc, typename Growth>
+SmallDynamicArray<T, N, Alloc, Growth>&
+SmallDynamicArray<T, N, Alloc, Growth>::operator=(SmallDynamicArray&& other) noexcept(
+    std::is_nothrow_move_constructible_v<T> &&
+    (alloc_traits::propagate_on_container_move_assignment::value ||
+     alloc_traits::is_always_equal::value))
+{
+    if (this == &other) return *this;
+
+    clear();
+    release_heap();
+
+    if constexpr (alloc_traits::propagate_on_container_move_assignment::value) {
+        alloc_ = std::move(other.alloc_);
+    } else if constexpr (!alloc_traits::is_always_equal::value) {
+        if (alloc_ != other.alloc_) {
+            // Cannot adopt a block from an unequal allocator
+            reserve(other.size_);
+            relocate(other.data_, other.size_, data_);
+            size_ = std::exchange(other.size_, 0);
+            return *this;
+        }
+    }
+    steal(other);
+
+    return *this;
+}
+
+template <typename T, std::size_t N, typename Alloc, typename Growth>
+SmallDynamicArray<T, N, Alloc, Growth>::~SmallDynamicArray() {
+    clear();
+    release_heap();
+}
+
+//–– element insertion ––//
+
+template <typename T, std::size_t N, typename Alloc, typename Growth>
+void SmallDynamicArray<T, N, Alloc, Growth>::push_back(const T& v) {
+    emplace_back(v);
+}
+
+template <typename T, std::size_t N, typename Alloc, typename Growth>
+void SmallDynamicArray<T, N, Alloc, Growth>::push_back(T&& v) {
+    emplace_back(std::move(v));
+}
+
+template <typename T, std::size_t N, typename Alloc, typename Growth>
+template <typename... Args>
+T& SmallDynamicArray<T, N, Alloc, Growth>::emplace_back(Args&&... args) {
+    if (size_ < cap_) {
+        alloc_traits::construct(alloc_, data_ + size_, std::forward<Args>(args)...);
+        return data_[size_++];
+    }
+
+    // Build the new element first: args may alias an element being moved
+    std::size_t new_cap = next_capacity(size_ + 1);
+    T* tmp = alloc_traits::allocate(alloc_, new_cap);
+    try {
+        alloc_traits::construct(alloc_, tmp + size_, std::forward<Args>(args)...);
+    } catch (...) {
+        alloc_traits::deallocate(alloc_, tmp, new_cap);
+        throw;
+    }
+    try {
+        relocate(data_, size_, tmp);
+    } catch (...) {
+        alloc_traits::destroy(alloc_, tmp + size_);
+        alloc_traits::deallocate(alloc_, tmp, new_cap);
+        throw;
+    }
+    release_heap();
+    data_ = tmp;
+    cap_ = new_cap;
+    return data_[size_++];
+}
+
+//–– access ––//
+
+template <typename T, std::size_t N, typename Alloc, typename Growth>
+T& SmallDynamicArray<T, N, Alloc, Growth>::operator[](std::size_t i) {
+    return data_[i];
+}
+
+template <typename T, std::size_t N, typename Alloc, typename Growth>
+T const& SmallDynamicArray<T, N, Alloc, Growth>::operator[](std::size_t i) const {
+    return data_[i];
+}
+
+template <typename T, std::size_t N, typename Alloc, typename Growth>
+T* SmallDynamicArray<T, N, Alloc, Growth>::data() noexcept {
+    return data_;
+}
+
+template <typename T, std::size_t N, typename Alloc, typename Growth>
+T const* SmallDynamicArray<T, N, Alloc, Growth>::data() const noexcept {
+    return data_;
+}
+
+template <typename T, std::size_t N, typename Alloc, typename Growth>
+typename SmallDynamicArray<T, N, Alloc, Growth>::iterator
+SmallDynamicArray<T, N, Alloc, Growth>::begin() noexcept {
+    return data_;
+}
+
+template <typename T, std::size_t N, typename Alloc, typename Growth>
+typename SmallDynamicArray<T, N, Alloc, Growth>::iterator
+SmallDynamicArray<T, N, Alloc, Growth>::end() noexcept {
+    return data_ + size_;
+}
+
+template <typename T, std::size_t N, typename Alloc, typename Growth>
+typename SmallDynamicArray<T, N, Alloc, Growth>::const_iterator
+SmallDynamicArray<T, N, Alloc, Growth>::begin() const noexcept {
+    return data_;
+}
+
+template <typename T, std::size_t N, typename Alloc, typename Growth>
+typename SmallDynamicArray<T, N, Alloc, Growth>::const_iterator
+SmallDynamicArray<T, N, Alloc, Growth>::end() const noexcept {
+    return data_ + size_;
+}
+
+template <typename T, std::size_t N, typename Alloc, typename Growth>
+std::size_t SmallDynamicArray<T, N, Alloc, Growth>::size() const noexcept {
+    return size_;
+}
+
+template <typename T, std::size_t N, typename Alloc, typename Growth>
+std::size_t SmallDynamicArray<T, N, Alloc, Growth>::capacity() const noexcept {
+    return cap_;
+}
+
+template <typename T, std::size_t N, typename Alloc, typename Growth>
+bool SmallDynamicArray<T, N, Alloc, Growth>::is_inline() const noexcept {
+    return data_ == reinterpret_cast<T const*>(inline_);
+}
+
+template <typename T, std::size_t N, typename Alloc, typename Growth>
+typename SmallDynamicArray<T, N, Alloc, Growth>::allocator_type
+SmallDynamicArray<T, N, Alloc, Growth>::get_allocator() const noexcept {
+    return alloc_;
+}
+
+//–– storage management ––//
+
+template <typename T, std::size_t N, typename Alloc, typename Growth>
+void SmallDynamicArray<T, N, Alloc, Growth>::reserve(std::size_t new_cap) {
+    if (new_cap <= cap_) return;
+    if (new_cap > alloc_traits::max_size(alloc_))
+        throw std::length_error("SmallDynamicArray::reserve: capacity too large");
+    reallocate(new_cap);
+}
+
+template <typename T, std::size_t N, typename Alloc, typename Growth>
+void SmallDynamicArray<T, N, Alloc, Growth>::shrink_to_fit() {
+    if (is_inline() || size_ == cap_) return;
+
+    if (size_ <= N) {
+        T* heap = data_;
+        std::size_t heap_cap = cap_;
+        relocate(heap, size_, inline_data());
+        alloc_traits::deallocate(alloc_, heap, heap_cap);
+        data_ = inline_data();
+        cap_ = N;
+        return;
+    }
+    reallocate(size_);
+}
+
+template <typename T, std::size_t N, typename Alloc, typename Growth>
+void SmallDynamicArray<T, N, Alloc, Growth>::resize(std::size_t new_size) {
+    if (new_size <= size_) {
+        for (std::size_t i = new_size; i < size_; ++i)
+            alloc_traits::destroy(alloc_, data_ + i);
+        size_ = new_size;
+        return;
+    }
+    grow_to(new_size);
+}
+
+template <typename T, std::size_t N, typename Alloc, typename Growth>
+void SmallDynamicArray<T, N, Alloc, Growth>::resize(std::size_t new_size, const T& value) {
+    if (new_size <= size_) {
+        for (std::size_t i = new_size; i < size_; ++i)
+            alloc_traits::destroy(alloc_, data_ + i);
+        size_ = new_size;
+        return;
+    }
+    if (new_size > cap_ && &value >= data_ && &value < data_ + size_) {
+        T copy(value);
+        grow_to(new_size, copy);
+        return;
+    }
+    grow_to(new_size, value);
+}
+
+template <typename T, std::size_t N, typename Alloc, typename Growth>
+void SmallDynamicArray<T, N, Alloc, Growth>::clear() noexcept {
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+        for (std::size_t i = 0; i < size_; ++i)
+            alloc_traits::destroy(alloc_, data_ + i);
+    }
+    size_ = 0;
+}
+
+template <typename T, std::size_t N, typename Alloc, typename Growth>
+template <typename... Args>
+void SmallDynamicArray<T, N, Alloc, Growth>::grow_to(std::size_t new_size, const Args&... args) {
+    if (new_size > cap_)
+        reserve(next_capacity(new_size));
+
+    std::size_t i = size_;
+    try {
+        for (; i < new_size; ++i)
+            alloc_traits::construct(alloc_, data_ + i, args...);
+    } catch (...) {
+        for (std::size_t j = size_; j < i; ++j)
+            alloc_traits::destroy(alloc_, data_ + j);
+        throw;
+    }
+    size_ = new_size;
+}
+
+template <typename T, std::size_t N, typename Alloc, typename Growth>
+T* SmallDynamicArray<T, N, Alloc, Growth>::inline_data() noexcept {
+    return reinterpret_cast<T*>(inline_);
+}
+
+template <typename T, std::size_t N, typename Alloc, typename Growth>
+std::size_t SmallDynamicArray<T, N, Alloc, Growth>::next_capacity(std::size_t min_cap) const {
+    std::size_t n = Growth::next(cap_, min_cap);
+    if (n < min_cap || n > alloc_traits::max_size(alloc_))
+        throw std::length_error("SmallDynamicArray: capacity overflow");
+    return n;
+}
+
+template <typename T, std::size_t N, typename Alloc, typename Growth>
+void SmallDynamicArray<T, N, Alloc, Growth>::reallocate(std::size_t new_cap) {
+    T* tmp = alloc_traits::allocate(alloc_, new_cap);
+    try {
+        relocate(data_, size_, tmp);
+    } catch (...) {
+        alloc_traits::deallocate(alloc_, tmp, new_cap);
+        throw;
+    }
+    release_heap();
+    data_ = tmp;
+    cap_ = new_cap;
+}
+
+template <typename T, std::size_t N, typename Alloc, typename Growth>
+void SmallDynamicArray<T, N, Alloc, Growth>::release_heap() noexcept {
+    if (!is_inline()) {
+        alloc_traits::deallocate(alloc_, data_, cap_);
+        data_ = inline_data();
+        cap_ = N;
+    }
+}
+
+// Takes other's elements; expects *this to be empty and inline.
+template <typename T, std::size_t N, typename Alloc, typename Growth>
+void SmallDynamicArray<T, N, Alloc, Growth>::steal(SmallDynamicArray& other)
+    noexcept(std::is_nothrow_move_constructible_v<T>)
+{
+    if (other.is_inline()) {
+        if constexpr (std::is_nothrow_move_constructible_v<T>) {
+            for (std::size_t i = 0; i < other.size_; ++i)
+                alloc_traits::construct(alloc_, data_ + i, std::move(other.data_[i]));
+            size_ = other.size_;
+        } else {
+            try {
+                for (std::size_t i = 0; i < other.size_; ++i) {
+                    alloc_traits::construct(alloc_, data_ + i, std::move(other.data_[i]));
+                    size_ = i + 1;
+                }
+            } catch (...) {
+                clear();
+                throw;
+            }
+        }
+        other.clear();
+        return;
+    }
+    data_ = std::exchange(other.data_, other.inline_data());
+    size_ = std::exchange(other.size_, 0);
+    cap_ = std::exchange(other.cap_, N);
+}
+
+template <typename T, std::size_t N, typename Alloc, typename Growth>
+void SmallDynamicArray<T, N, Alloc, Growth>::relocate(T* src, std::size_t n, T* dst) {
+    if (n == 0) return;
+
+    if constexpr (std::is_trivially_copyable_v<T>) {
+        std::memcpy(static_cast<void*>(dst), src, n * sizeof(T));
+    } else {
+        constexpr bool use_move = std::is_nothrow_move_constructible_v<T> ||
+                                  !std::is_copy_constructible_v<T>;
+        std::size_t i = 0;
+        try {
+            for (; i < n; ++i) {
+                if constexpr (use_move)
+                    alloc_traits::construct(alloc_, dst + i, std::move(src[i]));
+                else
+                    alloc_traits::construct(alloc_, dst + i, src[i]);
+            }
+        } catch (...) {
+            for (std::size_t j = 0; j < i; ++j)
+                alloc_traits::destroy(alloc_, dst + j);
+            throw;
+        }
+        for (std::size_t j = 0; j < n; ++j)
+            alloc_traits::destroy(alloc_, src + j);
+    }
+}
+
+template <typename T, std::size_t N, typename Alloc, typename Growth>
+void SmallDynamicArray<T, N, Alloc, Growth>::copy_construct(T const* src, std::size_t n, T* dst) {
+    if (n == 0) return;
+
+    if constexpr (std::is_trivially_copyable_v<T>) {
+        std::memcpy(static_cast<void*>(dst), src, n * sizeof(T));
+    } else {
+        std::size_t i = 0;
+        try {
+            for (; i < n; ++i)
+                alloc_traits::construct(alloc_, dst + i, src[i]);
+        } catch (...) {
+            for (std::size_t j = 0; j < i; ++j)
+                alloc_traits::destroy(alloc_, dst + j);
+            throw;
+        }
+    }
+}
+
+#endif // INCLUDE_SMALLDYNAMICARRAY_HPP_
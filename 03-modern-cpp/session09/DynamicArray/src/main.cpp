@@ -1,9 +1,15 @@
 #include <iostream>
 #include <cassert>
+#include <string>
+#include <memory>
+#include <stdexcept>
 #include "DynamicArray.hpp"
+#include "ReallocAllocator.hpp"
+#include "SmallDynamicArray.hpp"
+#include "BulkOps.hpp"
 
 void test_push_and_access() {
-    DynamicArray d(2);
+    DynamicArray<int> d(2);
     assert(d.size() == 0);
     assert(d.capacity() == 2);
 
@@ -25,12 +31,12 @@ void test_push_and_access() {
 }
 
 void test_copy_constructor() {
-    DynamicArray orig(3);
+    DynamicArray<int> orig(3);
     orig.push_back(5);
     orig.push_back(6);
     orig.push_back(7);
 
-    DynamicArray copy(orig);
+    DynamicArray<int> copy(orig);
     // Copy should have the same size/capacity and contents
     assert(copy.size()     == orig.size());
     assert(copy.capacity() == orig.capacity());
@@ -43,10 +49,10 @@ void test_copy_constructor() {
 }
 
 void test_copy_assignment() {
-    DynamicArray a(1);
+    DynamicArray<int> a(1);
     a.push_back(9);
 
-    DynamicArray b(5);
+    DynamicArray<int> b(5);
     b.push_back(1);
     b.push_back(2);
 
@@ -60,11 +66,11 @@ void test_copy_assignment() {
 }
 
 void test_move_constructor() {
-    DynamicArray temp(4);
+    DynamicArray<int> temp(4);
     temp.push_back(11);
     temp.push_back(22);
 
-    DynamicArray moved(std::move(temp));
+    DynamicArray<int> moved(std::move(temp));
     // moved-from temp should be empty
     assert(temp.size()     == 0);
     assert(temp.capacity() == 0);
@@ -76,11 +82,11 @@ void test_move_constructor() {
 }
 
 void test_move_assignment() {
-    DynamicArray x(3);
+    DynamicArray<int> x(3);
     x.push_back(7);
     x.push_back(8);
 
-    DynamicArray y(1);
+    DynamicArray<int> y(1);
     y = std::move(x);
     // moved-from x is empty
     assert(x.size()     == 0);
@@ -96,12 +102,361 @@ void test_move_assignment() {
     assert(y.size() == 2 && y[0] == 7 && y[1] == 8);
 }
 
+// Counts live objects so leaks and double-destroys show up in asserts
+struct Tracked {
+    static int live;
+    int value;
+    std::string tag;
+
+    Tracked(int v, std::string t) : value(v), tag(std::move(t)) { ++live; }
+    Tracked(const Tracked& o) : value(o.value), tag(o.tag) { ++live; }
+    Tracked(Tracked&& o) noexcept : value(o.value), tag(std::move(o.tag)) { ++live; }
+    ~Tracked() { --live; }
+};
+int Tracked::live = 0;
+
+// Minimal allocator that records how many blocks it handed out
+template <typename T>
+struct CountingAllocator {
+    using value_type = T;
+    static int allocations;
+
+    CountingAllocator() = default;
+    template <typename U>
+    CountingAllocator(const CountingAllocator<U>&) noexcept {}
+
+    T* allocate(std::size_t n) {
+        ++allocations;
+        return std::allocator<T>{}.allocate(n);
+    }
+    void deallocate(T* p, std::size_t n) noexcept {
+        std::allocator<T>{}.deallocate(p, n);
+    }
+    template <typename U>
+    bool operator==(const CountingAllocator<U>&) const noexcept { return true; }
+    template <typename U>
+    bool operator!=(const CountingAllocator<U>&) const noexcept { return false; }
+};
+template <typename T>
+int CountingAllocator<T>::allocations = 0;
+
+void test_emplace_non_trivial() {
+    {
+        DynamicArray<Tracked> d(1);
+        // Reserving capacity must not construct any elements
+        assert(Tracked::live == 0);
+
+        d.emplace_back(1, "one");
+        d.emplace_back(2, "two");   // grows 1 → 2, moves "one"
+        d.emplace_back(3, "three"); // grows 2 → 4
+        assert(Tracked::live == 3);
+        assert(d.size() == 3 && d.capacity() == 4);
+        assert(d[0].tag == "one" && d[2].value == 3);
+
+        DynamicArray<Tracked> copy(d);
+        assert(Tracked::live == 6);
+        assert(copy[1].tag == "two");
+
+        // Pushing an element of the array itself while growing must be safe
+        d.emplace_back(4, "four");
+        d.push_back(d[0]);
+        assert(d.size() == 5 && d[4].tag == "one");
+    }
+    assert(Tracked::live == 0);
+}
+
+void test_move_only_elements() {
+    DynamicArray<std::unique_ptr<int>> d(1);
+    d.push_back(std::make_unique<int>(7));
+    d.emplace_back(new int(8));
+    assert(d.size() == 2);
+    assert(*d[0] == 7 && *d[1] == 8);
+
+    DynamicArray<std::unique_ptr<int>> moved(std::move(d));
+    assert(d.size() == 0);
+    assert(*moved[1] == 8);
+}
+
+void test_custom_allocator() {
+    CountingAllocator<int>::allocations = 0;
+    DynamicArray<int, CountingAllocator<int>> d(2);
+    assert(CountingAllocator<int>::allocations == 1);
+
+    for (int i = 0; i < 8; ++i) d.push_back(i);
+    // 2 → 4 → 8
+    assert(CountingAllocator<int>::allocations == 3);
+
+    int sum = 0;
+    for (int v : d) sum += v;
+    assert(sum == 28);
+}
+
+void test_reserve_resize_shrink() {
+    DynamicArray<int> d;
+    assert(d.capacity() == 0);
+
+    d.reserve(10);
+    assert(d.capacity() == 10 && d.size() == 0);
+    d.reserve(4);                 // never shrinks
+    assert(d.capacity() == 10);
+
+    d.resize(3);                  // value-initialised
+    assert(d.size() == 3 && d[0] == 0 && d[2] == 0);
+    d.resize(6, 7);
+    assert(d.size() == 6 && d[3] == 7 && d[5] == 7);
+    d.resize(2);
+    assert(d.size() == 2 && d.capacity() == 10);
+
+    d.shrink_to_fit();
+    assert(d.capacity() == 2);
+    assert(d[0] == 0 && d[1] == 0);
+
+    d.resize(0);
+    d.shrink_to_fit();
+    assert(d.capacity() == 0);
+    d.push_back(5);               // usable again after releasing everything
+    assert(d.size() == 1 && d[0] == 5);
+
+    {
+        DynamicArray<Tracked> t;
+        t.emplace_back(1, "a");
+        t.resize(4, t[0]);        // fill value aliases an element being moved
+        assert(t.size() == 4 && t[3].tag == "a");
+        t.resize(1, t[0]);
+        assert(Tracked::live == 1);
+    }
+    assert(Tracked::live == 0);
+}
+
+void test_growth_policies() {
+    DynamicArray<int, std::allocator<int>, HalfStepGrowth> half(4);
+    for (int i = 0; i < 5; ++i) half.push_back(i);
+    assert(half.capacity() == 6);     // 4 → 6
+    for (int i = 0; i < 2; ++i) half.push_back(i);
+    assert(half.capacity() == 9);     // 6 → 9
+
+    DynamicArray<int, std::allocator<int>, HalfStepGrowth> tiny(1);
+    tiny.push_back(1);
+    tiny.push_back(2);                // 1 + 1/2 would not grow at all
+    assert(tiny.capacity() == 2);
+
+    DynamicArray<int, std::allocator<int>, FixedChunkGrowth<16>> chunk;
+    for (int i = 0; i < 17; ++i) chunk.push_back(i);
+    assert(chunk.capacity() == 32);   // 0 → 16 → 32
+    assert(chunk[16] == 16);
+
+    chunk.resize(100);                // jumps straight to the requested size
+    assert(chunk.capacity() == 100);
+}
+
+void test_realloc_growth() {
+    using Big = DynamicArray<int, ReallocAllocator<int>>;
+    // Enough ints to cross from malloc'd blocks into mremap'd mappings
+    const int n = 3 * static_cast<int>(ReallocAllocator<int>::kMapThreshold / sizeof(int));
+
+    Big d;
+    for (int i = 0; i < n; ++i) d.push_back(i);
+    d.push_back(d[0]);            // argument aliases the block being resized
+    assert(d.size() == static_cast<std::size_t>(n) + 1);
+    for (int i = 0; i < n; i += 4099) assert(d[i] == i);
+    assert(d[n] == 0);
+
+    Big copy(d);
+    assert(copy.size() == d.size() && copy[n - 1] == n - 1);
+
+    d.resize(10);                 // shrink back below the mapping threshold
+    d.shrink_to_fit();
+    assert(d.capacity() == 10 && d[9] == 9);
+
+    d.reserve(static_cast<std::size_t>(n));
+    assert(d.capacity() == static_cast<std::size_t>(n) && d[5] == 5);
+}
+
+void test_small_inline_and_spill() {
+    CountingAllocator<int>::allocations = 0;
+    SmallDynamicArray<int, 4, CountingAllocator<int>> s;
+    assert(s.size() == 0 && s.capacity() == 4 && s.is_inline());
+
+    for (int i = 0; i < 4; ++i) s.push_back(i);
+    assert(s.is_inline());
+    assert(CountingAllocator<int>::allocations == 0);
+
+    s.push_back(4);               // spills 4 → 8 on the heap
+    assert(!s.is_inline() && s.capacity() == 8);
+    assert(CountingAllocator<int>::allocations == 1);
+    for (int i = 0; i < 5; ++i) assert(s[i] == i);
+
+    s.resize(3);
+    s.shrink_to_fit();            // fits inline again
+    assert(s.is_inline() && s.capacity() == 4);
+    assert(s[2] == 2);
+}
+
+void test_small_copy() {
+    SmallDynamicArray<Tracked, 2> inl;
+    inl.emplace_back(1, "a");
+
+    SmallDynamicArray<Tracked, 2> heap;
+    for (int i = 0; i < 5; ++i) heap.emplace_back(i, "h");
+
+    {
+        SmallDynamicArray<Tracked, 2> c1(inl);
+        SmallDynamicArray<Tracked, 2> c2(heap);
+        assert(c1.is_inline() && c1.size() == 1 && c1[0].tag == "a");
+        assert(!c2.is_inline() && c2.size() == 5 && c2[4].value == 4);
+
+        // Mutating the original must not affect the copy
+        inl[0].tag = "changed";
+        assert(c1[0].tag == "a");
+        inl[0].tag = "a";
+
+        c2 = inl;                 // heap → inline-sized contents
+        assert(c2.size() == 1 && c2[0].tag == "a");
+        c1 = heap;                // inline → spilled
+        assert(c1.size() == 5 && !c1.is_inline());
+
+        c1 = c1;                  // self-assignment is safe
+        assert(c1.size() == 5 && c1[3].value == 3);
+    }
+    assert(Tracked::live == 6);
+}
+
+void test_small_move() {
+    {
+        SmallDynamicArray<Tracked, 2> inl;
+        inl.emplace_back(1, "a");
+        SmallDynamicArray<Tracked, 2> moved(std::move(inl));
+        // moved-from inline array is empty but keeps its inline capacity
+        assert(inl.size() == 0 && inl.capacity() == 2);
+        assert(moved.size() == 1 && moved[0].tag == "a");
+
+        SmallDynamicArray<Tracked, 2> heap;
+        for (int i = 0; i < 3; ++i) heap.emplace_back(i, "h");
+        Tracked const* block = heap.data();
+        SmallDynamicArray<Tracked, 2> stolen(std::move(heap));
+        // spilled arrays hand over their heap block without touching elements
+        assert(stolen.data() == block && stolen.size() == 3);
+        assert(heap.size() == 0 && heap.is_inline());
+
+        moved = std::move(stolen);
+        assert(moved.size() == 3 && moved[2].value == 2);
+        assert(stolen.size() == 0);
+
+        moved = std::move(moved); // self move-assignment is safe
+        assert(moved.size() == 3);
+
+        heap.emplace_back(7, "again"); // moved-from array is reusable
+        assert(heap[0].value == 7);
+    }
+    assert(Tracked::live == 0);
+}
+
+void test_bulk_ops() {
+    DynamicArray<int> d;
+    for (int i = 0; i < 1000; ++i) d.push_back(i - 500);
+
+    assert(bulk::sum(d) == -500);
+    auto mm = bulk::minmax(d);
+    assert(mm.first == -500 && mm.second == 499);
+    assert(bulk::find(d, 17) == 517);
+    assert(bulk::find(d, 5000) == d.size());
+
+    // needles are not narrowed to the element type first
+    DynamicArray<char> text;
+    for (char c : {'a', ',', 'b'}) text.push_back(c);
+    assert(bulk::find(text, 300) == text.size());   // 300 as a char is ','
+    assert(bulk::find(text, int(',')) == 1);
+    assert(bulk::find(d, 17.5) == d.size());
+    assert(bulk::find(d, 17.0) == 517);
+    assert(bulk::find(d, 1e30) == d.size());
+    assert(bulk::find(d, -(1LL << 40)) == d.size());
+
+    bulk::transform(d, [](int x) { return x * 2; });
+    assert(d[0] == -1000 && d[999] == 998);
+
+    bulk::fill(d, 3);
+    assert(bulk::sum(d) == 3000);
+
+    const double src[] = {1.5, -2.0, 4.25};
+    DynamicArray<double> f;
+    bulk::copy_from(f, src, 3);
+    assert(f.size() == 3 && f[2] == 4.25);
+    assert(bulk::sum(f) == 3.75);
+
+    SmallDynamicArray<int, 8> s;  // any array with data()/size() works
+    bulk::copy_from(s, d);
+    assert(s.size() == 1000 && bulk::sum(s) == 3000);
+
+    DynamicArray<int> empty;
+    assert(bulk::sum(empty) == 0);
+    assert(bulk::find(empty, 1) == 0);
+    bool threw = false;
+    try { bulk::minmax(empty); } catch (const std::underflow_error&) { threw = true; }
+    assert(threw);
+}
+
+void test_bulk_ops_parallel() {
+    // Small min_chunk so that the threaded path really splits the array
+    bulk::ParallelPolicy pol;
+    pol.threads = 4;
+    pol.min_chunk = 100;
+
+    DynamicArray<int> d;
+    d.resize(100003);
+    bulk::fill(pol, d, 1);
+    d[77777] = -9;
+    d[99999] = 42;
+
+    assert(bulk::sum(pol, d) == 100003 - 1 - 9 - 1 + 42);
+    auto mm = bulk::minmax(pol, d);
+    assert(mm.first == -9 && mm.second == 42);
+    assert(bulk::find(pol, d, 42) == 99999);
+    assert(bulk::find(pol, d, 7) == d.size());
+
+    d[5] = 42;                    // earliest match wins across slices
+    assert(bulk::find(pol, d, 42) == 5);
+
+    bulk::transform(pol, d, [](int x) { return x + 1; });
+    assert(d[0] == 2 && d[77777] == -8);
+
+    DynamicArray<int> copy;
+    bulk::copy_from(pol, copy, d);
+    assert(copy.size() == d.size() && copy[99999] == 43);
+
+    // an exception in the caller's slice or a worker's reaches the caller
+    // once all slices are done
+    for (std::size_t bad : {std::size_t(10), std::size_t(99990)}) {
+        d[bad] = -1000;
+        bool threw = false;
+        try {
+            bulk::transform(pol, d, [](int x) {
+                if (x == -1000) throw std::runtime_error("bad element");
+                return x;
+            });
+        } catch (const std::runtime_error&) {
+            threw = true;
+        }
+        assert(threw);
+    }
+}
+
 int main() {
     test_push_and_access();
     test_copy_constructor();
     test_copy_assignment();
     test_move_constructor();
     test_move_assignment();
+    test_emplace_non_trivial();
+    test_move_only_elements();
+    test_custom_allocator();
+    test_reserve_resize_shrink();
+    test_growth_policies();
+    test_realloc_growth();
+    test_small_inline_and_spill();
+    test_small_copy();
+    test_small_move();
+    test_bulk_ops();
+    test_bulk_ops_parallel();
 
     std::cout << "All DynamicArray tests passed successfully!\n";
     return 0;
@@ -0,0 +1,75 @@
+// Long accumulation chains with the original Fraction and the checked
+// BasicFraction<Int, Reduction> (32/64/128-bit, eager and lazy):
+//   sum     x += n/d with small random n and d | 2520, like summing
+//           calibration ratios that share a handful of denominators
+//   product x *= (k+1)/k for k = 1..N, which telescopes to N+1
+// The chains are sized so that the original class does not overflow
+// (beyond that it wraps silently; BasicFraction throws instead).
+//
+//   g++ -std=c++17 -O2 -Iinclude bench/accumulate_bench.cpp src/Fraction.cpp -o accumulate_bench
+//   ./accumulate_bench [sum_terms]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+#include "BasicFraction.hpp"
+#include "Fraction.hpp"
+
+static const int kDivisors[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 12, 14, 15, 18, 20, 21,
+                                24, 28, 30, 35, 36, 40, 42, 45, 56, 60, 63, 70, 72, 84,
+                                90, 105, 120, 126, 140, 168, 180, 210, 252, 280, 315,
+                                360, 420, 504, 630, 840, 1260, 2520};
+
+static double value(const Fraction& f) {
+	return double(f.getNumerator()) / f.getDenominator();
+}
+
+template <typename Int, Reduction R>
+static double value(const BasicFraction<Int, R>& f) {
+	return f.toDouble();
+}
+
+template <typename F>
+static void run(const char* name, const std::vector<std::pair<int, int>>& terms, int product_n) {
+	using clock = std::chrono::steady_clock;
+
+	std::vector<F> in;
+	in.reserve(terms.size());
+	for (auto [n, d] : terms) in.push_back(F(n, d));
+
+	auto t0 = clock::now();
+	F sum(0);
+	for (const F& x : in) sum += x;
+	auto t1 = clock::now();
+
+	F prod(1);
+	for (int k = 1; k <= product_n; ++k) prod *= F(k + 1, k);
+	auto t2 = clock::now();
+
+	std::printf("%-24s sum %7.2f ns/op  = %-12.4f   product %7.2f ns/op  = %.0f\n", name,
+	            std::chrono::duration<double, std::nano>(t1 - t0).count() / in.size(), value(sum),
+	            std::chrono::duration<double, std::nano>(t2 - t1).count() / product_n, value(prod));
+}
+
+int main(int argc, char** argv) {
+	std::size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 2'000'000;
+	const int product_n = 40000;   // k*(k+1) still fits in 32 bits
+
+	std::mt19937 rng(7);
+	std::uniform_int_distribution<int> num(-3, 3);
+	std::uniform_int_distribution<std::size_t> div(0, std::size(kDivisors) - 1);
+	std::vector<std::pair<int, int>> terms(n);
+	for (auto& t : terms) t = {num(rng), kDivisors[div(rng)]};
+
+	std::printf("%zu sum terms, product of %d ratios\n\n", n, product_n);
+	run<Fraction>("Fraction (original)", terms, product_n);
+	run<Fraction32>("Fraction32", terms, product_n);
+	run<BasicFraction<int32_t, Reduction::Lazy>>("Fraction32 lazy", terms, product_n);
+	run<Fraction64>("Fraction64", terms, product_n);
+	run<BasicFraction<int64_t, Reduction::Lazy>>("Fraction64 lazy", terms, product_n);
+	run<Fraction128>("Fraction128", terms, product_n);
+	run<BasicFraction<int128_t, Reduction::Lazy>>("Fraction128 lazy", terms, product_n);
+	return 0;
+}
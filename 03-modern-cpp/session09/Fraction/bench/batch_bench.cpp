@@ -0,0 +1,94 @@
+// Throughput of the FractionArray batch kernels (sum, dot, element-wise
+// add and multiply) against scalar loops over arrays of fractions: the
+// original Fraction where it cannot overflow, and Fraction64 otherwise.
+// Inputs look like calibration ratios: small numerators over denominators
+// that divide 2520.
+//
+//   g++ -std=c++17 -O2 -pthread -Iinclude bench/batch_bench.cpp src/Fraction.cpp -o batch_bench
+//   ./batch_bench [elements] [threads]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+#include "Fraction.hpp"
+#include "FractionBatch.hpp"
+
+static const int kDivisors[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 12, 14, 15, 18, 20, 21,
+                                24, 28, 30, 35, 36, 40, 42, 45, 56, 60, 63, 70, 72, 84,
+                                90, 105, 120, 126, 140, 168, 180, 210, 252, 280, 315,
+                                360, 420, 504, 630, 840, 1260, 2520};
+
+template <typename F>
+static double mops(std::size_t n, F f) {
+	auto t0 = std::chrono::steady_clock::now();
+	f();
+	double s = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+	return n / s / 1e6;
+}
+
+static double value(const Fraction64& f) {
+	return f.toDouble();
+}
+
+int main(int argc, char** argv) {
+	std::size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 4'000'000;
+	unsigned hw = std::thread::hardware_concurrency();
+	batch::ParallelPolicy par{argc > 2 ? unsigned(std::atoi(argv[2])) : 0};
+
+	std::mt19937 rng(11);
+	std::uniform_int_distribution<int> num(-3, 3);
+	std::uniform_int_distribution<std::size_t> div(0, std::size(kDivisors) - 1);
+
+	std::vector<Fraction> xs, ys;
+	xs.reserve(n);
+	ys.reserve(n);
+	for (std::size_t i = 0; i < n; ++i) {
+		xs.emplace_back(num(rng), kDivisors[div(rng)]);
+		ys.emplace_back(num(rng), kDivisors[div(rng)]);
+	}
+	std::vector<Fraction64> xs64, ys64;
+	for (std::size_t i = 0; i < n; ++i) {
+		xs64.emplace_back(xs[i].getNumerator(), xs[i].getDenominator());
+		ys64.emplace_back(ys[i].getNumerator(), ys[i].getDenominator());
+	}
+	FractionArray<> x(xs.begin(), xs.end()), y(ys.begin(), ys.end()), out;
+	out.resize(n);
+
+	std::printf("%zu elements, %u hardware threads (Mops/s, higher is better)\n\n", n, hw);
+
+	// sum
+	Fraction f_sum;
+	Fraction64 s_sum, b_sum, p_sum;
+	double r0 = mops(n, [&] { for (const Fraction& f : xs) f_sum += f; });
+	double r1 = mops(n, [&] { for (const Fraction64& f : xs64) s_sum += f; });
+	double r2 = mops(n, [&] { b_sum = batch::sum(x); });
+	double r3 = mops(n, [&] { p_sum = batch::sum(par, x); });
+	std::printf("sum       Fraction %7.1f   Fraction64 %7.1f   batch %7.1f   batch::par %7.1f   [%g %g %g]\n",
+	            r0, r1, r2, r3, double(f_sum.getNumerator()) / f_sum.getDenominator(),
+	            value(b_sum), value(p_sum));
+
+	// dot (products over 2520^2 do not fit the original class)
+	Fraction64 s_dot, b_dot, p_dot;
+	r1 = mops(n, [&] { for (std::size_t i = 0; i < n; ++i) s_dot += xs64[i] * ys64[i]; });
+	r2 = mops(n, [&] { b_dot = batch::dot(x, y); });
+	r3 = mops(n, [&] { p_dot = batch::dot(par, x, y); });
+	std::printf("dot       Fraction %7s   Fraction64 %7.1f   batch %7.1f   batch::par %7.1f   [%g %g %g]\n",
+	            "-", r1, r2, r3, value(s_dot), value(b_dot), value(p_dot));
+
+	// element-wise
+	std::vector<Fraction> f_out(n);
+	r0 = mops(n, [&] { for (std::size_t i = 0; i < n; ++i) f_out[i] = xs[i] + ys[i]; });
+	r2 = mops(n, [&] { batch::add(x, y, out); });
+	r3 = mops(n, [&] { batch::add(par, x, y, out); });
+	std::printf("add       Fraction %7.1f   Fraction64 %7s   batch %7.1f   batch::par %7.1f\n",
+	            r0, "-", r2, r3);
+
+	r0 = mops(n, [&] { for (std::size_t i = 0; i < n; ++i) f_out[i] = xs[i] * ys[i]; });
+	r2 = mops(n, [&] { batch::multiply(x, y, out); });
+	r3 = mops(n, [&] { batch::multiply(par, x, y, out); });
+	std::printf("multiply  Fraction %7.1f   Fraction64 %7s   batch %7.1f   batch::par %7.1f\n",
+	            r0, "-", r2, r3);
+	return 0;
+}
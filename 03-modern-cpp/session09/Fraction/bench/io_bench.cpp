@@ -0,0 +1,97 @@
+// Formatting and parsing "n/d" text: the iostream operators against the
+// to_chars/from_chars path (FractionIO), in memory and from a file
+// (ifstream versus MappedFile).
+//
+//   g++ -std=c++17 -O2 -Iinclude bench/io_bench.cpp src/Fraction.cpp src/FractionIO.cpp -o io_bench
+//   ./io_bench [fractions] [file]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "Fraction.hpp"
+#include "FractionIO.hpp"
+
+using clock_type = std::chrono::steady_clock;
+
+static double seconds(clock_type::time_point t0) {
+	return std::chrono::duration<double>(clock_type::now() - t0).count();
+}
+
+static void report(const char* name, std::size_t bytes, std::size_t count, double s) {
+	std::printf("%-28s %8.1f MB/s %8.1f M fractions/s\n", name, bytes / s / 1e6, count / s / 1e6);
+}
+
+static long long checksum(const std::vector<Fraction>& v) {
+	long long s = 0;
+	for (const Fraction& f : v) s += f.getNumerator() + f.getDenominator();
+	return s;
+}
+
+int main(int argc, char** argv) {
+	std::size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 5'000'000;
+	const char* path = argc > 2 ? argv[2] : "/tmp/fractions.txt";
+
+	std::mt19937 rng(3);
+	std::uniform_int_distribution<int> num(-1'000'000, 1'000'000), den(1, 100'000);
+	std::vector<Fraction> src;
+	src.reserve(n);
+	for (std::size_t i = 0; i < n; ++i) src.emplace_back(num(rng), den(rng));
+
+	// format
+	auto t0 = clock_type::now();
+	std::ostringstream os;
+	for (const Fraction& f : src) os << f << '\n';
+	std::string streamText = os.str();
+	report("format  ostream <<", streamText.size(), n, seconds(t0));
+
+	t0 = clock_type::now();
+	std::string text;
+	formatFractions(text, src.data(), src.size());
+	report("format  toChars", text.size(), n, seconds(t0));
+	if (text != streamText) std::printf("  output differs!\n");
+
+	// parse from memory
+	std::vector<Fraction> a, b;
+	a.reserve(n);
+	b.reserve(n);
+	t0 = clock_type::now();
+	std::istringstream is(text);
+	for (Fraction f; is >> f;) a.push_back(f);
+	report("parse   istream >>", text.size(), n, seconds(t0));
+
+	t0 = clock_type::now();
+	parseFractions(text.data(), text.data() + text.size(), b);
+	report("parse   fromChars", text.size(), n, seconds(t0));
+	if (a.size() != n || b.size() != n || checksum(a) != checksum(b)) std::printf("  results differ!\n");
+
+	// parse from a file
+	std::FILE* out = std::fopen(path, "w");
+	if (!out || std::fwrite(text.data(), 1, text.size(), out) != text.size()) {
+		std::perror(path);
+		return 1;
+	}
+	std::fclose(out);
+
+	a.clear();
+	t0 = clock_type::now();
+	std::ifstream in(path);
+	for (Fraction f; in >> f;) a.push_back(f);
+	report("file    ifstream >>", text.size(), n, seconds(t0));
+
+	b.clear();
+	t0 = clock_type::now();
+	{
+		MappedFile file(path);
+		parseFractions(file.data(), file.data() + file.size(), b);
+	}
+	report("file    MappedFile+fromChars", text.size(), n, seconds(t0));
+	if (a.size() != n || b.size() != n || checksum(a) != checksum(b)) std::printf("  results differ!\n");
+
+	std::remove(path);
+	return 0;
+}
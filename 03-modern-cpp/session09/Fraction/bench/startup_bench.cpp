@@ -0,0 +1,55 @@
+// Cost of building a table of scaling constants at startup versus having
+// the compiler fold it. Both tables hold the same N fractions; the
+// runtime one is built the way a non-constexpr global would be during
+// static initialisation (its input is hidden from the optimiser), the
+// constexpr one already sits in .rodata when the program starts.
+//
+//   g++ -std=c++17 -O2 -Iinclude bench/startup_bench.cpp src/Fraction.cpp -o startup_bench
+//   ./startup_bench
+//
+// (GCC may need -fconstexpr-ops-limit=... for much larger tables.)
+
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include "Fraction.hpp"
+
+constexpr int kEntries = 2048;
+
+// entry i: i/360 of an inch in millimetres plus a fixed 1/8 offset,
+// the kind of derived constant that used to be computed at startup
+constexpr std::array<Fraction, kEntries> makeTable(int base) {
+	std::array<Fraction, kEntries> t{};
+	const Fraction mmPerInch(254, 10);
+	for (int i = 0; i < kEntries; ++i)
+		t[i] = Fraction(i, base) * mmPerInch + Fraction(1, 8);
+	return t;
+}
+
+constexpr std::array<Fraction, kEntries> kFolded = makeTable(360);
+
+static long long checksum(const std::array<Fraction, kEntries>& t) {
+	long long s = 0;
+	for (const Fraction& f : t) s += f.getNumerator() * 31LL + f.getDenominator();
+	return s;
+}
+
+int main() {
+	volatile int base = 360;   // keeps the runtime table from being folded
+
+	const int runs = 200;
+	long long sink = 0;
+	auto t0 = std::chrono::steady_clock::now();
+	for (int r = 0; r < runs; ++r) {
+		std::array<Fraction, kEntries> t = makeTable(base);
+		sink += t[r % kEntries].getNumerator();
+	}
+	double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count() / runs;
+
+	std::array<Fraction, kEntries> runtime = makeTable(base);
+	std::printf("%d-entry table\n", kEntries);
+	std::printf("  built at startup     %8.1f us per program start\n", us);
+	std::printf("  constexpr            no startup code, %zu bytes of .rodata\n", sizeof(kFolded));
+	std::printf("  tables %s  [%lld]\n", checksum(runtime) == checksum(kFolded) ? "match" : "DIFFER", sink);
+	return 0;
+}
@@ -0,0 +1,404 @@
+#ifndef BASIC_FRACTION_HPP
+#define BASIC_FRACTION_HPP
+
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+
+__extension__ typedef __int128 int128_t;
+__extension__ typedef unsigned __int128 uint128_t;
+
+// Eager: every result is fully reduced, like Fraction.
+// Lazy:  values (constructed ones too) are left unreduced until an
+//        intermediate would overflow, the value is observed
+//        (getNumerator/getDenominator, comparisons) or normalize() is
+//        called. Long chains of +, - and * then skip most gcds.
+enum class Reduction { Eager, Lazy };
+
+namespace fraction_detail {
+
+template <typename Int> struct unsigned_of;
+template <> struct unsigned_of<std::int32_t> { using type = std::uint32_t; };
+template <> struct unsigned_of<std::int64_t> { using type = std::uint64_t; };
+template <> struct unsigned_of<int128_t>     { using type = uint128_t; };
+
+// |a| without overflow, even for the most negative value
+template <typename Int>
+typename unsigned_of<Int>::type magnitude(Int a) {
+	using U = typename unsigned_of<Int>::type;
+	return a < 0 ? U(0) - U(a) : U(a);
+}
+
+// gcd(|a|, b) for b > 0; the result divides b, so it fits in Int
+template <typename Int>
+Int gcd(Int a, Int b) {
+	using U = typename unsigned_of<Int>::type;
+	U x = magnitude(a), y = U(b);
+	while (y) {
+		U t = x % y;
+		x = y;
+		y = t;
+	}
+	return Int(x);
+}
+
+template <typename Int>
+Int mul(Int a, Int b) {
+	Int r;
+	if (__builtin_mul_overflow(a, b, &r))
+		throw std::overflow_error("Fraction: multiplication overflows");
+	return r;
+}
+
+template <typename Int>
+Int add(Int a, Int b) {
+	Int r;
+	if (__builtin_add_overflow(a, b, &r))
+		throw std::overflow_error("Fraction: addition overflows");
+	return r;
+}
+
+template <typename Int>
+Int neg(Int a) {
+	Int r;
+	if (__builtin_sub_overflow(Int(0), a, &r))
+		throw std::overflow_error("Fraction: negation overflows");
+	return r;
+}
+
+// The same checks, reporting failure instead of throwing
+template <typename Int>
+bool try_mul(Int a, Int b, Int& r) { return !__builtin_mul_overflow(a, b, &r); }
+
+template <typename Int>
+bool try_add(Int a, Int b, Int& r) { return !__builtin_add_overflow(a, b, &r); }
+
+} // namespace fraction_detail
+
+// Overflow-checked rational number over Int (int32_t, int64_t or int128_t).
+//
+// The denominator is always positive. Arithmetic cancels common factors
+// before multiplying (Knuth's algorithms for + and *), so intermediates
+// stay as small as the result allows; if the result still does not fit,
+// the operation throws std::overflow_error instead of wrapping.
+template <typename Int, Reduction R = Reduction::Eager>
+class BasicFraction {
+	static_assert(std::is_same_v<Int, std::int32_t> || std::is_same_v<Int, std::int64_t> ||
+	              std::is_same_v<Int, int128_t>,
+	              "BasicFraction supports int32_t, int64_t and int128_t");
+
+public:
+	// throws std::invalid_argument for a zero denominator
+	BasicFraction(Int num = 0, Int den = 1);
+
+	// reduced numerator/denominator (reduces a lazy fraction first)
+	Int getNumerator() const;
+	Int getDenominator() const;
+
+	// brings a lazy fraction to lowest terms; no-op when eager
+	void normalize();
+
+	double toDouble() const;
+
+	BasicFraction  operator+(const BasicFraction& other) const;
+	BasicFraction& operator+=(const BasicFraction& other);
+
+	BasicFraction  operator-(const BasicFraction& other) const;
+	BasicFraction& operator-=(const BasicFraction& other);
+
+	BasicFraction  operator*(const BasicFraction& other) const;
+	BasicFraction& operator*=(const BasicFraction& other);
+
+	// throws std::domain_error when dividing by zero
+	BasicFraction  operator/(const BasicFraction& other) const;
+	BasicFraction& operator/=(const BasicFraction& other);
+
+	BasicFraction operator-() const;
+
+	BasicFraction& operator++();
+	BasicFraction  operator++(int);
+
+	BasicFraction& operator--();
+	BasicFraction  operator--(int);
+
+	bool operator==(const BasicFraction& other) const;
+	bool operator!=(const BasicFraction& other) const;
+	bool operator<(const BasicFraction& other) const;
+	bool operator>(const BasicFraction& other) const;
+	bool operator<=(const BasicFraction& other) const;
+	bool operator>=(const BasicFraction& other) const;
+
+private:
+	Int num_;
+	Int den_;
+
+	struct Raw {};
+	BasicFraction(Raw, Int num, Int den);
+
+	void simplify();
+	static BasicFraction add_reduced(const BasicFraction& a, const BasicFraction& b);
+	static BasicFraction mul_reduced(const BasicFraction& a, const BasicFraction& b);
+	static int compare(BasicFraction a, BasicFraction b);
+};
+
+using Fraction32  = BasicFraction<std::int32_t>;
+using Fraction64  = BasicFraction<std::int64_t>;
+using Fraction128 = BasicFraction<int128_t>;
+
+//–– construction ––//
+
+template <typename Int, Reduction R>
+BasicFraction<Int, R>::BasicFraction(Int num, Int den)
+  : num_(num), den_(den)
+{
+	if (!den_)
+		throw std::invalid_argument("Fraction: zero denominator");
+	if (den_ < 0) {
+		num_ = fraction_detail::neg(num_);
+		den_ = fraction_detail::neg(den_);
+	}
+	if constexpr (R == Reduction::Eager)
+		simplify();
+}
+
+// num/den with den > 0, taken as is
+template <typename Int, Reduction R>
+BasicFraction<Int, R>::BasicFraction(Raw, Int num, Int den)
+  : num_(num), den_(den)
+{}
+
+template <typename Int, Reduction R>
+void BasicFraction<Int, R>::simplify() {
+	Int g = fraction_detail::gcd(num_, den_);
+	if (g != 1) {
+		num_ /= g;
+		den_ /= g;
+	}
+}
+
+template <typename Int, Reduction R>
+void BasicFraction<Int, R>::normalize() {
+	if constexpr (R == Reduction::Lazy)
+		simplify();
+}
+
+//–– accessors ––//
+
+template <typename Int, Reduction R>
+Int BasicFraction<Int, R>::getNumerator() const {
+	if constexpr (R == Reduction::Lazy)
+		return num_ / fraction_detail::gcd(num_, den_);
+	else
+		return num_;
+}
+
+template <typename Int, Reduction R>
+Int BasicFraction<Int, R>::getDenominator() const {
+	if constexpr (R == Reduction::Lazy)
+		return den_ / fraction_detail::gcd(num_, den_);
+	else
+		return den_;
+}
+
+template <typename Int, Reduction R>
+double BasicFraction<Int, R>::toDouble() const {
+	return static_cast<double>(num_) / static_cast<double>(den_);
+}
+
+//–– addition ––//
+
+// a + b for reduced a and b (Knuth 4.5.1): only gcd(den_a, den_b) and a
+// gcd against it are needed, and the result comes out reduced.
+template <typename Int, Reduction R>
+BasicFraction<Int, R> BasicFraction<Int, R>::add_reduced(const BasicFraction& a, const BasicFraction& b) {
+	using namespace fraction_detail;
+	Int g = gcd(a.den_, b.den_);
+	if (g == 1) {
+		return BasicFraction(Raw{}, add(mul(a.num_, b.den_), mul(b.num_, a.den_)),
+		                     mul(a.den_, b.den_));
+	}
+	Int s = a.den_ / g;
+	Int t = add(mul(a.num_, b.den_ / g), mul(b.num_, s));
+	Int g2 = gcd(t, g);
+	return BasicFraction(Raw{}, t / g2, mul(s, b.den_ / g2));
+}
+
+template <typename Int, Reduction R>
+BasicFraction<Int, R> BasicFraction<Int, R>::operator+(const BasicFraction& other) const {
+	if constexpr (R == Reduction::Lazy) {
+		using namespace fraction_detail;
+		Int n, d, x, y;
+		if (den_ == other.den_) {
+			if (try_add(num_, other.num_, n))
+				return BasicFraction(Raw{}, n, den_);
+		} else if (try_mul(num_, other.den_, x) && try_mul(other.num_, den_, y) &&
+		           try_add(x, y, n) && try_mul(den_, other.den_, d)) {
+			return BasicFraction(Raw{}, n, d);
+		}
+		// would overflow unreduced: reduce the operands and cancel instead
+		BasicFraction a = *this, b = other;
+		a.simplify();
+		b.simplify();
+		return add_reduced(a, b);
+	} else {
+		return add_reduced(*this, other);
+	}
+}
+
+template <typename Int, Reduction R>
+BasicFraction<Int, R>& BasicFraction<Int, R>::operator+=(const BasicFraction& other) {
+	return *this = *this + other;
+}
+
+template <typename Int, Reduction R>
+BasicFraction<Int, R> BasicFraction<Int, R>::operator-(const BasicFraction& other) const {
+	return *this + -other;
+}
+
+template <typename Int, Reduction R>
+BasicFraction<Int, R>& BasicFraction<Int, R>::operator-=(const BasicFraction& other) {
+	return *this = *this - other;
+}
+
+template <typename Int, Reduction R>
+BasicFraction<Int, R> BasicFraction<Int, R>::operator-() const {
+	return BasicFraction(Raw{}, fraction_detail::neg(num_), den_);
+}
+
+//–– multiplication ––//
+
+// a * b for reduced a and b: cross-cancel first, so the products are of
+// already coprime factors and the result comes out reduced.
+template <typename Int, Reduction R>
+BasicFraction<Int, R> BasicFraction<Int, R>::mul_reduced(const BasicFraction& a, const BasicFraction& b) {
+	using namespace fraction_detail;
+	Int g1 = gcd(a.num_, b.den_);
+	Int g2 = gcd(b.num_, a.den_);
+	return BasicFraction(Raw{}, mul(a.num_ / g1, b.num_ / g2), mul(a.den_ / g2, b.den_ / g1));
+}
+
+template <typename Int, Reduction R>
+BasicFraction<Int, R> BasicFraction<Int, R>::operator*(const BasicFraction& other) const {
+	if constexpr (R == Reduction::Lazy) {
+		using namespace fraction_detail;
+		Int n, d;
+		if (try_mul(num_, other.num_, n) && try_mul(den_, other.den_, d))
+			return BasicFraction(Raw{}, n, d);
+		BasicFraction a = *this, b = other;
+		a.simplify();
+		b.simplify();
+		return mul_reduced(a, b);
+	} else {
+		return mul_reduced(*this, other);
+	}
+}
+
+template <typename Int, Reduction R>
+BasicFraction<Int, R>& BasicFraction<Int, R>::operator*=(const BasicFraction& other) {
+	return *this = *this * other;
+}
+
+template <typename Int, Reduction R>
+BasicFraction<Int, R> BasicFraction<Int, R>::operator/(const BasicFraction& other) const {
+	if (other.num_ == 0)
+		throw std::domain_error("Fraction: division by zero");
+	// the reciprocal keeps the denominator positive and stays reduced
+	BasicFraction inv = other.num_ < 0
+		? BasicFraction(Raw{}, fraction_detail::neg(other.den_), fraction_detail::neg(other.num_))
+		: BasicFraction(Raw{}, other.den_, other.num_);
+	return *this * inv;
+}
+
+template <typename Int, Reduction R>
+BasicFraction<Int, R>& BasicFraction<Int, R>::operator/=(const BasicFraction& other) {
+	return *this = *this / other;
+}
+
+//–– increment/decrement ––//
+
+template <typename Int, Reduction R>
+BasicFraction<Int, R>& BasicFraction<Int, R>::operator++() {
+	// (n + d)/d is reduced whenever n/d is
+	num_ = fraction_detail::add(num_, den_);
+	return *this;
+}
+
+template <typename Int, Reduction R>
+BasicFraction<Int, R> BasicFraction<Int, R>::operator++(int) {
+	BasicFraction tmp = *this;
+	++*this;
+	return tmp;
+}
+
+template <typename Int, Reduction R>
+BasicFraction<Int, R>& BasicFraction<Int, R>::operator--() {
+	num_ = fraction_detail::add(num_, fraction_detail::neg(den_));
+	return *this;
+}
+
+template <typename Int, Reduction R>
+BasicFraction<Int, R> BasicFraction<Int, R>::operator--(int) {
+	BasicFraction tmp = *this;
+	--*this;
+	return tmp;
+}
+
+//–– comparison ––//
+
+// Sign of a - b, without overflow: compares the continued-fraction
+// expansions term by term instead of cross-multiplying.
+template <typename Int, Reduction R>
+int BasicFraction<Int, R>::compare(BasicFraction a, BasicFraction b) {
+	Int an = a.num_, ad = a.den_, bn = b.num_, bd = b.den_;
+	int sign = 1;
+	for (;;) {
+		// floor(n/d) and n mod d in [0, d), denominators are positive
+		Int ra = an % ad, rb = bn % bd;
+		Int qa = an / ad - (ra < 0), qb = bn / bd - (rb < 0);
+		if (ra < 0) ra += ad;
+		if (rb < 0) rb += bd;
+		if (qa != qb)
+			return qa < qb ? -sign : sign;
+		if (ra == 0 || rb == 0)
+			return sign * ((ra != 0) - (rb != 0));
+		// ra/ad < rb/bd  <=>  ad/ra > bd/rb
+		an = ad; ad = ra;
+		bn = bd; bd = rb;
+		sign = -sign;
+	}
+}
+
+template <typename Int, Reduction R>
+bool BasicFraction<Int, R>::operator==(const BasicFraction& other) const {
+	if constexpr (R == Reduction::Lazy)
+		return getNumerator() == other.getNumerator() && getDenominator() == other.getDenominator();
+	else
+		return num_ == other.num_ && den_ == other.den_;
+}
+
+template <typename Int, Reduction R>
+bool BasicFraction<Int, R>::operator!=(const BasicFraction& other) const {
+	return !(*this == other);
+}
+
+template <typename Int, Reduction R>
+bool BasicFraction<Int, R>::operator<(const BasicFraction& other) const {
+	return compare(*this, other) < 0;
+}
+
+template <typename Int, Reduction R>
+bool BasicFraction<Int, R>::operator>(const BasicFraction& other) const {
+	return compare(*this, other) > 0;
+}
+
+template <typename Int, Reduction R>
+bool BasicFraction<Int, R>::operator<=(const BasicFraction& other) const {
+	return compare(*this, other) <= 0;
+}
+
+template <typename Int, Reduction R>
+bool BasicFraction<Int, R>::operator>=(const BasicFraction& other) const {
+	return compare(*this, other) >= 0;
+}
+
+#endif // BASIC_FRACTION_HPP
@@ -1,32 +1,46 @@
 #ifndef FRACTION_HPP
 #define FRACTION_HPP
 
+#include <climits>
 #include <iostream>
+#include <numeric>
 
+// Everything except stream I/O is constexpr, so whole tables of
+// fractions can be computed by the compiler:
+//
+//     constexpr Fraction kInch = Fraction(254, 100) * Fraction(1, 100);
+//
+// A zero denominator in a constant expression is a compile error, and
+// so is a result that does not fit in an int, such as INT_MIN/-1.
 class Fraction {
 public:
-	Fraction(int num = 0, int den = 1);
+	constexpr Fraction(int num = 0, int den = 1);
 
-	void setNumerator(int num);
-	void setDenominator(int den);
+	// Like Fraction(num, den), except that when the reduced value does
+	// not fit in an int nothing is reported or clamped: returns false and
+	// leaves f unchanged. Reduces only once, for parsers.
+	static constexpr bool tryMake(int num, int den, Fraction& f);
 
-	int getNumerator() const;
-	int getDenominator() const;
+	constexpr void setNumerator(int num);
+	constexpr void setDenominator(int den);
 
-	Fraction  operator+(const Fraction& other);
-	Fraction& operator+=(const Fraction& other);
+	constexpr int getNumerator() const;
+	constexpr int getDenominator() const;
 
-	Fraction  operator-(const Fraction& other);
-	Fraction& operator-=(const Fraction& other);
+	constexpr Fraction  operator+(const Fraction& other) const;
+	constexpr Fraction& operator+=(const Fraction& other);
 
-	Fraction  operator*(const Fraction& other);
-	Fraction& operator*=(const Fraction& other);
+	constexpr Fraction  operator-(const Fraction& other) const;
+	constexpr Fraction& operator-=(const Fraction& other);
 
-	Fraction& operator++();
-	Fraction  operator++(int);
+	constexpr Fraction  operator*(const Fraction& other) const;
+	constexpr Fraction& operator*=(const Fraction& other);
 
-	Fraction& operator--();
-	Fraction  operator--(int);
+	constexpr Fraction& operator++();
+	constexpr Fraction  operator++(int);
+
+	constexpr Fraction& operator--();
+	constexpr Fraction  operator--(int);
 
 	friend std::ostream& operator<<(std::ostream& os, const Fraction& f);
 	friend std::istream& operator>>(std::istream& is, Fraction& f);
@@ -35,7 +49,143 @@ private:
 	int num_;
 	int den_;
 
-	void simplify();
+	constexpr void simplify();
+
+	// lowest terms with the sign on the numerator; false, with the
+	// magnitudes clamped to INT_MAX, if they do not fit in an int
+	constexpr bool reduce();
+
+	// report a zero denominator, or a reduced numerator or denominator
+	// outside int, which is then clamped to INT_MAX (not constexpr: they
+	// write to std::cerr)
+	static void invalidDenominator();
+	static void outOfRange();
 };
 
+constexpr Fraction::Fraction(int num, int den)
+  : num_(num), den_(den)
+{
+	if(!den_) {
+		invalidDenominator();
+		den_ = 1;
+	}
+	simplify();
+}
+
+constexpr bool Fraction::tryMake(int num, int den, Fraction& f) {
+	if (!den) {
+		f = Fraction(num, den);
+		return true;
+	}
+	Fraction r;
+	r.num_ = num;
+	r.den_ = den;
+	if (!r.reduce())
+		return false;
+	f = r;
+	return true;
+}
+
+constexpr void Fraction::setNumerator(int num) {
+	num_ = num;
+}
+
+constexpr void Fraction::setDenominator(int den) {
+	if (!den)
+		return;
+	den_ = den;
+}
+
+constexpr int Fraction::getNumerator() const {
+	return num_;
+}
+
+constexpr int Fraction::getDenominator() const {
+	return den_;
+}
+
+constexpr Fraction Fraction::operator+(const Fraction& other) const {
+	int l = std::lcm(den_, other.den_);
+	int x = l/den_, y = l/other.den_;
+	return Fraction{num_ * x + other.num_ * y, l};
+}
+
+constexpr Fraction& Fraction::operator+=(const Fraction& other) {
+	return *this = *this + other;
+}
+
+constexpr Fraction Fraction::operator-(const Fraction& other) const {
+	int l = std::lcm(den_, other.den_);
+	int x = l/den_, y = l/other.den_;
+	return Fraction{num_ * x - other.num_ * y, l};
+}
+
+constexpr Fraction& Fraction::operator-=(const Fraction& other) {
+	return *this = *this - other;
+}
+
+constexpr Fraction Fraction::operator*(const Fraction& other) const {
+	return Fraction{num_ * other.num_, den_ * other.den_};
+}
+
+constexpr Fraction& Fraction::operator*=(const Fraction& other) {
+	num_ *= other.num_;
+	den_ *= other.den_;
+	simplify();
+	return *this;
+}
+
+constexpr Fraction& Fraction::operator++() {
+	num_ += den_;
+	simplify();
+	return *this;
+}
+
+constexpr Fraction Fraction::operator++(int) {
+	Fraction tmp{num_, den_};
+	num_ += den_;
+	simplify();
+	return tmp;
+}
+
+constexpr Fraction& Fraction::operator--() {
+	num_ -= den_;
+	simplify();
+	return *this;
+}
+
+constexpr Fraction Fraction::operator--(int) {
+	Fraction tmp = *this;
+	--*this;
+	return tmp;
+}
+
+constexpr void Fraction::simplify() {
+	if (!reduce())
+		outOfRange();
+}
+
+constexpr bool Fraction::reduce() {
+	// magnitudes as unsigned, since -INT_MIN does not fit in an int
+	unsigned n = num_ < 0 ? 0u - static_cast<unsigned>(num_) : static_cast<unsigned>(num_);
+	unsigned d = den_ < 0 ? 0u - static_cast<unsigned>(den_) : static_cast<unsigned>(den_);
+	bool negative = num_ != 0 && (num_ < 0) != (den_ < 0);
+
+	unsigned g = std::gcd(n, d);
+	n /= g;
+	d /= g;
+
+	// INT_MIN/-1 and odd/INT_MIN reduce to a magnitude of 2^31
+	constexpr unsigned kMax = static_cast<unsigned>(INT_MAX);
+	bool fits = d <= kMax && (negative || n <= kMax);
+	if (!fits) {
+		n = n > kMax ? kMax : n;
+		d = d > kMax ? kMax : d;
+	}
+
+	num_ = negative ? -static_cast<int>(n - 1) - 1 : static_cast<int>(n);
+	den_ = static_cast<int>(d);
+	return fits;
+}
+
 #endif // FRACTION_HPP
@@ -0,0 +1,377 @@
+#ifndef FRACTION_BATCH_HPP
+#define FRACTION_BATCH_HPP
+
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "BasicFraction.hpp"
+#include "../../common/ParallelChunks.hpp"
+
+// Bulk rational arithmetic over arrays of fractions.
+//
+// FractionArray keeps numerators and denominators in two separate arrays
+// (structure of arrays), so the kernels stream through plain integers
+// instead of constructing a Fraction, and running simplify(), per element.
+// Reductions (sum, dot) accumulate in a type twice as wide over a common
+// denominator and reduce only when a term does not fit it and once at
+// the end; element-wise kernels do a single gcd per output. Every kernel
+// takes an optional execution policy: batch::seq (default) or
+// batch::par, which splits the arrays across threads.
+
+// Numerators and denominators of n fractions, stored apart. Denominators
+// are always positive; entries are kept as given (not reduced).
+template <typename Int = std::int32_t>
+class FractionArray {
+public:
+	using value_type = BasicFraction<Int>;
+
+	FractionArray() = default;
+	explicit FractionArray(std::size_t n);
+
+	// from any range of fractions with getNumerator()/getDenominator(),
+	// e.g. std::vector<Fraction>
+	template <typename It>
+	FractionArray(It first, It last);
+
+	// throws std::invalid_argument for a zero denominator
+	void push_back(Int num, Int den);
+	template <typename F>
+	void push_back(const F& f);
+
+	// reduced copy of element i
+	value_type operator[](std::size_t i) const;
+
+	std::size_t size() const noexcept;
+	bool empty() const noexcept;
+	void reserve(std::size_t n);
+	// new elements are 0/1
+	void resize(std::size_t n);
+	void clear() noexcept;
+
+	const Int* numerators() const noexcept;
+	const Int* denominators() const noexcept;
+	Int* numerators() noexcept;
+	Int* denominators() noexcept;
+
+private:
+	std::vector<Int> num_;
+	std::vector<Int> den_;
+};
+
+namespace batch {
+
+using SequentialPolicy = parallel::SequentialPolicy;
+using ParallelPolicy = parallel::BasicParallelPolicy<1 << 14>;
+
+inline constexpr SequentialPolicy seq{};
+inline constexpr ParallelPolicy par{};
+
+namespace detail {
+
+// Accumulator type: products of two Ints never overflow it (except for
+// int128_t, which has nothing wider and relies on the overflow checks)
+template <typename Int> struct wide;
+template <> struct wide<std::int32_t> { using type = std::int64_t; };
+template <> struct wide<std::int64_t> { using type = int128_t; };
+template <> struct wide<int128_t>     { using type = int128_t; };
+
+template <typename Int>
+using wide_t = typename wide<Int>::type;
+
+using parallel::for_each_chunk;
+using parallel::max_threads;
+
+// Exact running sum n/d kept over a common denominator d. A term whose
+// denominator divides d (the usual case once the few denominators of a
+// table have been seen) is scaled up and added without growing d or
+// computing a gcd; anything else takes the general lazy addition.
+template <typename W>
+class RunningSum {
+public:
+	void add(W tn, W td) {
+		W q = d_ / td;
+		W x;
+		if (q * td == d_ && fraction_detail::try_mul(tn, q, x) && fraction_detail::try_add(n_, x, x)) {
+			n_ = x;
+			return;
+		}
+		BasicFraction<W, Reduction::Lazy> s = BasicFraction<W, Reduction::Lazy>(n_, d_) +
+		                                      BasicFraction<W, Reduction::Lazy>(tn, td);
+		n_ = s.getNumerator();
+		d_ = s.getDenominator();
+	}
+
+	void add(const RunningSum& other) { add(other.n_, other.d_); }
+
+	// reduced result
+	BasicFraction<W> value() const { return BasicFraction<W>(n_, d_); }
+
+private:
+	W n_ = 0;
+	W d_ = 1;
+};
+
+template <typename Int>
+RunningSum<wide_t<Int>> sum_kernel(const FractionArray<Int>& x, std::size_t b, std::size_t e) {
+	const Int *xn = x.numerators(), *xd = x.denominators();
+	RunningSum<wide_t<Int>> s;
+	for (std::size_t i = b; i < e; ++i)
+		s.add(xn[i], xd[i]);
+	return s;
+}
+
+template <typename Int>
+RunningSum<wide_t<Int>> dot_kernel(const FractionArray<Int>& x, const FractionArray<Int>& y,
+                                   std::size_t b, std::size_t e) {
+	using W = wide_t<Int>;
+	const Int *xn = x.numerators(), *xd = x.denominators();
+	const Int *yn = y.numerators(), *yd = y.denominators();
+	RunningSum<W> s;
+	for (std::size_t i = b; i < e; ++i)
+		s.add(fraction_detail::mul<W>(xn[i], yn[i]), fraction_detail::mul<W>(xd[i], yd[i]));
+	return s;
+}
+
+// Reduces n/d (d > 0) and stores it, or throws if it does not fit in Int
+template <typename Int>
+void store(Int* num, Int* den, std::size_t i, wide_t<Int> n, wide_t<Int> d) {
+	wide_t<Int> g = fraction_detail::gcd(n, d);
+	n /= g;
+	d /= g;
+	if (n != wide_t<Int>(Int(n)) || d != wide_t<Int>(Int(d)))
+		throw std::overflow_error("Fraction: element does not fit the output type");
+	num[i] = Int(n);
+	den[i] = Int(d);
+}
+
+template <typename Int>
+void add_kernel(const FractionArray<Int>& x, const FractionArray<Int>& y, FractionArray<Int>& out,
+                std::size_t b, std::size_t e) {
+	using W = wide_t<Int>;
+	using fraction_detail::add;
+	using fraction_detail::mul;
+	const Int *xn = x.numerators(), *xd = x.denominators();
+	const Int *yn = y.numerators(), *yd = y.denominators();
+	Int *on = out.numerators(), *od = out.denominators();
+	for (std::size_t i = b; i < e; ++i) {
+		if (xd[i] == yd[i])
+			store<Int>(on, od, i, add<W>(xn[i], yn[i]), xd[i]);
+		else
+			store<Int>(on, od, i, add<W>(mul<W>(xn[i], yd[i]), mul<W>(yn[i], xd[i])),
+			           mul<W>(xd[i], yd[i]));
+	}
+}
+
+template <typename Int>
+void mul_kernel(const FractionArray<Int>& x, const FractionArray<Int>& y, FractionArray<Int>& out,
+                std::size_t b, std::size_t e) {
+	using W = wide_t<Int>;
+	using fraction_detail::mul;
+	const Int *xn = x.numerators(), *xd = x.denominators();
+	const Int *yn = y.numerators(), *yd = y.denominators();
+	Int *on = out.numerators(), *od = out.denominators();
+	for (std::size_t i = b; i < e; ++i)
+		store<Int>(on, od, i, mul<W>(xn[i], yn[i]), mul<W>(xd[i], yd[i]));
+}
+
+template <typename Int>
+void check_sizes(const FractionArray<Int>& x, const FractionArray<Int>& y) {
+	if (x.size() != y.size())
+		throw std::invalid_argument("Fraction batch: array sizes differ");
+}
+
+} // namespace detail
+
+//–– sum ––//
+
+// Exact sum, reduced, in the wide type (e.g. Fraction64 for int32_t input)
+template <typename Int>
+BasicFraction<detail::wide_t<Int>> sum(const SequentialPolicy&, const FractionArray<Int>& a) {
+	return detail::sum_kernel(a, 0, a.size()).value();
+}
+
+template <typename Int>
+BasicFraction<detail::wide_t<Int>> sum(const ParallelPolicy& pol, const FractionArray<Int>& a) {
+	std::vector<detail::RunningSum<detail::wide_t<Int>>> partial(detail::max_threads(pol));
+	std::size_t chunks = detail::for_each_chunk(pol, a.size(),
+		[&](std::size_t b, std::size_t e, std::size_t c) {
+			partial[c] = detail::sum_kernel(a, b, e);
+		});
+	for (std::size_t c = 1; c < chunks; ++c) partial[0].add(partial[c]);
+	return partial[0].value();
+}
+
+template <typename Int>
+BasicFraction<detail::wide_t<Int>> sum(const FractionArray<Int>& a) {
+	return sum(seq, a);
+}
+
+//–– dot ––//
+
+// Exact sum of x[i] * y[i]; throws std::invalid_argument on a size mismatch
+template <typename Int>
+BasicFraction<detail::wide_t<Int>> dot(const SequentialPolicy&, const FractionArray<Int>& x,
+                                       const FractionArray<Int>& y) {
+	detail::check_sizes(x, y);
+	return detail::dot_kernel(x, y, 0, x.size()).value();
+}
+
+template <typename Int>
+BasicFraction<detail::wide_t<Int>> dot(const ParallelPolicy& pol, const FractionArray<Int>& x,
+                                       const FractionArray<Int>& y) {
+	detail::check_sizes(x, y);
+	std::vector<detail::RunningSum<detail::wide_t<Int>>> partial(detail::max_threads(pol));
+	std::size_t chunks = detail::for_each_chunk(pol, x.size(),
+		[&](std::size_t b, std::size_t e, std::size_t c) {
+			partial[c] = detail::dot_kernel(x, y, b, e);
+		});
+	for (std::size_t c = 1; c < chunks; ++c) partial[0].add(partial[c]);
+	return partial[0].value();
+}
+
+template <typename Int>
+BasicFraction<detail::wide_t<Int>> dot(const FractionArray<Int>& x, const FractionArray<Int>& y) {
+	return dot(seq, x, y);
+}
+
+//–– add / multiply ––//
+
+// out[i] = x[i] + y[i], reduced; out is resized to match. Throws
+// std::overflow_error if a reduced element does not fit in Int.
+template <typename Int>
+void add(const SequentialPolicy&, const FractionArray<Int>& x, const FractionArray<Int>& y,
+         FractionArray<Int>& out) {
+	detail::check_sizes(x, y);
+	out.resize(x.size());
+	detail::add_kernel(x, y, out, 0, x.size());
+}
+
+template <typename Int>
+void add(const ParallelPolicy& pol, const FractionArray<Int>& x, const FractionArray<Int>& y,
+         FractionArray<Int>& out) {
+	detail::check_sizes(x, y);
+	out.resize(x.size());
+	detail::for_each_chunk(pol, x.size(),
+		[&](std::size_t b, std::size_t e, std::size_t) {
+			detail::add_kernel(x, y, out, b, e);
+		});
+}
+
+template <typename Int>
+void add(const FractionArray<Int>& x, const FractionArray<Int>& y, FractionArray<Int>& out) {
+	add(seq, x, y, out);
+}
+
+// out[i] = x[i] * y[i], reduced; same contract as add()
+template <typename Int>
+void multiply(const SequentialPolicy&, const FractionArray<Int>& x, const FractionArray<Int>& y,
+              FractionArray<Int>& out) {
+	detail::check_sizes(x, y);
+	out.resize(x.size());
+	detail::mul_kernel(x, y, out, 0, x.size());
+}
+
+template <typename Int>
+void multiply(const ParallelPolicy& pol, const FractionArray<Int>& x, const FractionArray<Int>& y,
+              FractionArray<Int>& out) {
+	detail::check_sizes(x, y);
+	out.resize(x.size());
+	detail::for_each_chunk(pol, x.size(),
+		[&](std::size_t b, std::size_t e, std::size_t) {
+			detail::mul_kernel(x, y, out, b, e);
+		});
+}
+
+template <typename Int>
+void multiply(const FractionArray<Int>& x, const FractionArray<Int>& y, FractionArray<Int>& out) {
+	multiply(seq, x, y, out);
+}
+
+} // namespace batch
+
+//–– FractionArray ––//
+
+template <typename Int>
+FractionArray<Int>::FractionArray(std::size_t n)
+  : num_(n, Int(0)), den_(n, Int(1))
+{}
+
+template <typename Int>
+template <typename It>
+FractionArray<Int>::FractionArray(It first, It last) {
+	for (; first != last; ++first) push_back(*first);
+}
+
+template <typename Int>
+void FractionArray<Int>::push_back(Int num, Int den) {
+	if (!den)
+		throw std::invalid_argument("Fraction: zero denominator");
+	if (den < 0) {
+		num = fraction_detail::neg(num);
+		den = fraction_detail::neg(den);
+	}
+	num_.push_back(num);
+	den_.push_back(den);
+}
+
+template <typename Int>
+template <typename F>
+void FractionArray<Int>::push_back(const F& f) {
+	push_back(f.getNumerator(), f.getDenominator());
+}
+
+template <typename Int>
+typename FractionArray<Int>::value_type FractionArray<Int>::operator[](std::size_t i) const {
+	return value_type(num_[i], den_[i]);
+}
+
+template <typename Int>
+std::size_t FractionArray<Int>::size() const noexcept {
+	return num_.size();
+}
+
+template <typename Int>
+bool FractionArray<Int>::empty() const noexcept {
+	return num_.empty();
+}
+
+template <typename Int>
+void FractionArray<Int>::reserve(std::size_t n) {
+	num_.reserve(n);
+	den_.reserve(n);
+}
+
+template <typename Int>
+void FractionArray<Int>::resize(std::size_t n) {
+	num_.resize(n, Int(0));
+	den_.resize(n, Int(1));
+}
+
+template <typename Int>
+void FractionArray<Int>::clear() noexcept {
+	num_.clear();
+	den_.clear();
+}
+
+template <typename Int>
+const Int* FractionArray<Int>::numerators() const noexcept {
+	return num_.data();
+}
+
+template <typename Int>
+const Int* FractionArray<Int>::denominators() const noexcept {
+	return den_.data();
+}
+
+template <typename Int>
+Int* FractionArray<Int>::numerators() noexcept {
+	return num_.data();
+}
+
+template <typename Int>
+Int* FractionArray<Int>::denominators() noexcept {
+	return den_.data();
+}
+
+#endif // FRACTION_BATCH_HPP
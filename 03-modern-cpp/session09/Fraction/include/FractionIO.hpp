@@ -0,0 +1,58 @@
+#ifndef FRACTION_IO_HPP
+#define FRACTION_IO_HPP
+
+#include <charconv>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <Fraction.hpp>
+
+// Fraction text I/O without iostreams, built on std::from_chars and
+// std::to_chars, for bulk "n/d" data held in memory or in a mapped file.
+//
+// Parsing accepts exactly what operator>> accepts: optional whitespace
+// before the numerator, the '/' and the denominator, an optional sign on
+// each number, and a zero denominator handled by the Fraction constructor.
+
+// Longest output of toChars: two ints of up to 11 characters and a '/'
+constexpr std::size_t kMaxFractionChars = 23;
+
+// Parses one fraction from [first, last). On success ec is std::errc{}
+// and ptr points past the denominator; otherwise f is unchanged, ec is
+// std::errc::invalid_argument (malformed) or result_out_of_range (a
+// number, or the reduced fraction such as INT_MIN/-1, does not fit in
+// int) and ptr points at the offending text.
+std::from_chars_result fromChars(const char* first, const char* last, Fraction& f);
+
+// Writes "n/d" to [first, last); ec is std::errc::value_too_large if it
+// does not fit (kMaxFractionChars always does)
+std::to_chars_result toChars(char* first, char* last, const Fraction& f);
+
+// Appends every fraction in [first, last) to out, like `while (is >> f)`:
+// stops at the end of input or at the first token that does not parse,
+// whose position and error are returned (ec is std::errc{} at the end).
+std::from_chars_result parseFractions(const char* first, const char* last, std::vector<Fraction>& out);
+
+// Appends the n fractions at f to out, each followed by sep
+void formatFractions(std::string& out, const Fraction* f, std::size_t n, char sep = '\n');
+
+// Read-only memory map of a whole file, for parsing it in place
+class MappedFile {
+public:
+	// throws std::system_error if the file cannot be opened or mapped
+	explicit MappedFile(const char* path);
+	~MappedFile();
+
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+
+	const char* data() const;
+	std::size_t size() const;
+
+private:
+	const char* data_ = nullptr;
+	std::size_t size_ = 0;
+};
+
+#endif // FRACTION_IO_HPP
@@ -0,0 +1,131 @@
+#include <FractionIO.hpp>
+#include <cerrno>
+#include <system_error>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+// the characters std::isspace accepts in the "C" locale
+bool isSpace(char c) {
+	return c == ' ' || (c >= '\t' && c <= '\r');
+}
+
+const char* skipSpace(const char* p, const char* last) {
+	while (p != last && isSpace(*p))
+		++p;
+	return p;
+}
+
+// Optional whitespace, then an int with an optional '+' or '-' sign,
+// as formatted extraction reads it
+std::from_chars_result parseInt(const char* first, const char* last, int& v) {
+	const char* p = skipSpace(first, last);
+	if (p != last && *p == '+') {
+		// from_chars does not take '+'; it must be followed by a digit
+		if (last - p < 2 || p[1] < '0' || p[1] > '9')
+			return {p, std::errc::invalid_argument};
+		++p;
+	}
+	return std::from_chars(p, last, v);
+}
+
+} // namespace
+
+std::from_chars_result fromChars(const char* first, const char* last, Fraction& f) {
+	int n, d;
+	std::from_chars_result r = parseInt(first, last, n);
+	if (r.ec != std::errc{})
+		return r;
+
+	const char* p = skipSpace(r.ptr, last);
+	if (p == last || *p != '/')
+		return {p, std::errc::invalid_argument};
+
+	r = parseInt(p + 1, last, d);
+	if (r.ec != std::errc{})
+		return r;
+	if (!Fraction::tryMake(n, d, f))
+		return {first, std::errc::result_out_of_range};
+	return r;
+}
+
+std::to_chars_result toChars(char* first, char* last, const Fraction& f) {
+	std::to_chars_result r = std::to_chars(first, last, f.getNumerator());
+	if (r.ec != std::errc{})
+		return r;
+	if (r.ptr == last)
+		return {last, std::errc::value_too_large};
+	*r.ptr = '/';
+	return std::to_chars(r.ptr + 1, last, f.getDenominator());
+}
+
+std::from_chars_result parseFractions(const char* first, const char* last, std::vector<Fraction>& out) {
+	const char* p = first;
+	for (;;) {
+		p = skipSpace(p, last);
+		if (p == last)
+			return {p, std::errc{}};
+		Fraction f;
+		std::from_chars_result r = fromChars(p, last, f);
+		if (r.ec != std::errc{})
+			return r;
+		out.push_back(f);
+		p = r.ptr;
+	}
+}
+
+void formatFractions(std::string& out, const Fraction* f, std::size_t n, char sep) {
+	std::size_t used = out.size();
+	out.resize(used + n * (kMaxFractionChars + 1));
+	char* p = out.data() + used;
+	char* end = out.data() + out.size();
+	for (std::size_t i = 0; i < n; ++i) {
+		p = toChars(p, end, f[i]).ptr;
+		*p++ = sep;
+	}
+	out.resize(p - out.data());
+}
+
+MappedFile::MappedFile(const char* path) {
+	int fd = ::open(path, O_RDONLY);
+	if (fd < 0)
+		throw std::system_error(errno, std::generic_category(), path);
+
+	struct stat st;
+	if (::fstat(fd, &st) < 0) {
+		int err = errno;
+		::close(fd);
+		throw std::system_error(err, std::generic_category(), path);
+	}
+	size_ = static_cast<std::size_t>(st.st_size);
+
+	// mmap rejects empty mappings; an empty file is just empty input
+	if (size_) {
+		void* p = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (p == MAP_FAILED) {
+			int err = errno;
+			::close(fd);
+			throw std::system_error(err, std::generic_category(), path);
+		}
+		::madvise(p, size_, MADV_SEQUENTIAL);
+		data_ = static_cast<const char*>(p);
+	}
+	::close(fd);
+}
+
+MappedFile::~MappedFile() {
+	if (data_)
+		::munmap(const_cast<char*>(data_), size_);
+}
+
+const char* MappedFile::data() const {
+	return data_;
+}
+
+std::size_t MappedFile::size() const {
+	return size_;
+}
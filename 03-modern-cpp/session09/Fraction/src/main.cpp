@@ -1,5 +1,208 @@
 #include "Fraction.hpp"
+#include "BasicFraction.hpp"
+#include "FractionBatch.hpp"
+#include "FractionIO.hpp"
+#include <array>
+#include <cassert>
+#include <climits>
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+#include <unistd.h>
+
+// Fraction arithmetic is constexpr: these are checked by the compiler
+constexpr bool equals(const Fraction& f, int num, int den) {
+    return f.getNumerator() == num && f.getDenominator() == den;
+}
+static_assert(equals(Fraction(6, -8), -3, 4));
+static_assert(equals(Fraction(INT_MIN, 1), INT_MIN, 1));
+static_assert(equals(Fraction(INT_MIN, -2), 1 << 30, 1));
+static_assert(equals(Fraction(INT_MIN, INT_MIN), 1, 1));
+static_assert(equals([] { Fraction f(1, 3); Fraction::tryMake(6, -8, f); return f; }(), -3, 4));
+static_assert(equals([] { Fraction f(1, 3); Fraction::tryMake(INT_MIN, -1, f); return f; }(), 1, 3));
+static_assert(equals(Fraction(10, 7) + Fraction(8, 11), 166, 77));
+static_assert(equals(Fraction(1, 2) - Fraction(1, 3), 1, 6));
+static_assert(equals(Fraction(4, 9) * Fraction(3, 8), 1, 6));
+static_assert(equals([] { Fraction f(1, 3); f += Fraction(1, 6); f *= Fraction(4); return f; }(), 2, 1));
+static_assert(equals([] { Fraction f(1, 2); ++f; f--; return --f; }(), -1, 2));
+
+// a table folded at compile time: partial sums of 1/k
+constexpr std::array<Fraction, 8> kHarmonic = [] {
+    std::array<Fraction, 8> h{};
+    Fraction sum;
+    for (int k = 1; k <= 8; ++k) h[k - 1] = sum += Fraction(1, k);
+    return h;
+}();
+static_assert(equals(kHarmonic[0], 1, 1));
+static_assert(equals(kHarmonic[7], 761, 280));
+
+// Checked fractions: same arithmetic, but no silent overflow
+template <typename F>
+void checkBasicFraction() {
+    F a(10, 7), b(8, 11);
+    F sum = a + b;
+    assert(sum.getNumerator() == 166 && sum.getDenominator() == 77);
+    assert(a - a == F(0));
+    assert(a * b == F(80, 77));
+    assert(a / b == F(110, 56));
+    assert(F(2, -4) == F(-1, 2));                   // sign lives in the numerator
+    assert(F(-1, 3) < F(1, 3) && F(1, 3) > F(1, 4) && F(2, 6) <= F(1, 3));
+
+    F x = a;
+    assert(x++ == a && x == F(17, 7));
+    assert(--x == a);
+
+    // telescoping product k/1 * (k+1)/k: cross-cancellation keeps it small
+    F p(1);
+    for (int k = 1; k < 100000; ++k) p *= F(k + 1, k);
+    assert(p == F(100000));
+
+    bool threw = false;
+    try { F(1, 0); } catch (const std::invalid_argument&) { threw = true; }
+    assert(threw);
+}
+
+void checkOverflowDetection() {
+    // 1/46349 + 1/46351: the denominator product does not fit in 32 bits
+    bool threw = false;
+    try { Fraction32(1, 46349) + Fraction32(1, 46351); } catch (const std::overflow_error&) { threw = true; }
+    assert(threw);
+
+    Fraction64 wide = Fraction64(1, 46349) + Fraction64(1, 46351);
+    assert(wide.getNumerator() == 92700 && wide.getDenominator() == 2148322499);
+
+    threw = false;
+    try { Fraction32(INT_MAX) * Fraction32(2); } catch (const std::overflow_error&) { threw = true; }
+    assert(threw);
+
+    // a lazy fraction reduces itself instead of overflowing
+    BasicFraction<int32_t, Reduction::Lazy> lazy(0);
+    for (int i = 0; i < 1000; ++i) lazy += BasicFraction<int32_t, Reduction::Lazy>(1, 6);
+    assert(lazy.getNumerator() == 500 && lazy.getDenominator() == 3);
+}
+
+void checkBatch() {
+    std::vector<Fraction> table;
+    for (int i = 1; i <= 5000; ++i) table.emplace_back(i % 7 - 3, i % 12 + 1);
+    FractionArray<> a(table.begin(), table.end());
+    FractionArray<> b;
+    for (int i = 1; i <= 5000; ++i) b.push_back(i % 5 + 1, -(i % 9 + 1));
+    assert(a.size() == 5000 && b.denominators()[0] > 0);
+
+    // reference results, one scalar operation at a time
+    Fraction64 sum, dot;
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        Fraction64 x(a[i].getNumerator(), a[i].getDenominator());
+        Fraction64 y(b[i].getNumerator(), b[i].getDenominator());
+        sum += x;
+        dot += x * y;
+    }
+
+    batch::ParallelPolicy par4{4, 256};     // force several threads
+    assert(batch::sum(a) == sum && batch::sum(par4, a) == sum);
+    assert(batch::dot(a, b) == dot && batch::dot(par4, a, b) == dot);
+
+    FractionArray<> s, p;
+    batch::add(par4, a, b, s);
+    batch::multiply(a, b, p);
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        assert(s[i] == a[i] + b[i]);
+        assert(p[i] == a[i] * b[i]);
+    }
+
+    bool threw = false;
+    FractionArray<> shorter(10);
+    try { batch::dot(a, shorter); } catch (const std::invalid_argument&) { threw = true; }
+    assert(threw);
+
+    // an overflow in a worker thread reaches the caller
+    FractionArray<> x(2000), y(2000), out;
+    x.push_back(1, 2147483647);
+    y.push_back(1, 2147483646);              // 1/p + 1/q does not fit in 32 bits
+    threw = false;
+    try { batch::add(par4, x, y, out); } catch (const std::overflow_error&) { threw = true; }
+    assert(threw);
+}
+
+// fromChars must accept and reject exactly what operator>> does
+void checkCharsIO() {
+    const char* inputs[] = {"3/4", "  -6/8", "+5/ 10", "7 /-14", "1\t/\n2", "0/5",
+                            "2147483647/1", "-2147483648/1", "3/0", "3/4/5", "3\\4",
+                            "", "   ", "/4", "3/", "3/+", "+/4", "- 3/4", "++3/4", "+-3/4",
+                            "99999999999/1", "1/-99999999999", "abc", "12x/3"};
+    for (const char* in : inputs) {
+        std::istringstream is(in);
+        Fraction a(42, 1), b(42, 1);
+        bool streamOk = static_cast<bool>(is >> a);
+        std::from_chars_result r = fromChars(in, in + std::strlen(in), b);
+        bool charsOk = r.ec == std::errc{};
+        assert(streamOk == charsOk);
+        if (streamOk) {
+            assert(a.getNumerator() == b.getNumerator() && a.getDenominator() == b.getDenominator());
+            auto pos = is.tellg();
+            assert(r.ptr - in == (pos < 0 ? std::streamoff(std::strlen(in)) : std::streamoff(pos)));
+        }
+    }
+
+    // round trip through a buffer
+    std::vector<Fraction> src;
+    for (int i = -50; i < 50; ++i) src.emplace_back(i * 37, i % 9 + 10);
+    src.emplace_back(INT_MIN, 1);
+    assert(src.back().getNumerator() == INT_MIN && src.back().getDenominator() == 1);
+    std::string text;
+    formatFractions(text, src.data(), src.size(), ' ');
+    std::ostringstream os;
+    for (const Fraction& f : src) os << f << ' ';
+    assert(text == os.str());
+
+    std::vector<Fraction> back;
+    std::from_chars_result r = parseFractions(text.data(), text.data() + text.size(), back);
+    assert(r.ec == std::errc{} && back.size() == src.size());
+    for (std::size_t i = 0; i < src.size(); ++i)
+        assert(back[i].getNumerator() == src[i].getNumerator() &&
+               back[i].getDenominator() == src[i].getDenominator());
+
+    // the same text through a mapped file
+    char path[] = "/tmp/fractionsXXXXXX";
+    int fd = mkstemp(path);
+    assert(fd >= 0 && write(fd, text.data(), text.size()) == ssize_t(text.size()));
+    close(fd);
+    {
+        MappedFile file(path);
+        back.clear();
+        r = parseFractions(file.data(), file.data() + file.size(), back);
+        assert(r.ec == std::errc{} && back.size() == src.size());
+    }
+    unlink(path);
+
+    // stops at the first bad token, like `while (is >> f)`
+    const char bad[] = "1/2 3/4 x/5 6/7";
+    back.clear();
+    r = parseFractions(bad, bad + sizeof bad - 1, back);
+    assert(back.size() == 2 && r.ec == std::errc::invalid_argument && *r.ptr == 'x');
+
+    // INT_MIN parses wherever the reduced fraction fits in int
+    const char* edges[] = {"-2147483648/1", "-2147483648/-2", "-2147483648/-1", "1/-2147483648", "2/-2147483648"};
+    const int edgeNum[] = {INT_MIN, 1 << 30, 0, 0, -1};
+    const int edgeDen[] = {1, 1, 0, 0, 1 << 30};
+    for (std::size_t i = 0; i < sizeof edges / sizeof edges[0]; ++i) {
+        Fraction f(42, 1);
+        std::from_chars_result e = fromChars(edges[i], edges[i] + std::strlen(edges[i]), f);
+        if (edgeDen[i]) {
+            assert(e.ec == std::errc{});
+            assert(f.getNumerator() == edgeNum[i] && f.getDenominator() == edgeDen[i]);
+        } else {
+            assert(e.ec == std::errc::result_out_of_range && e.ptr == edges[i]);
+            assert(f.getNumerator() == 42 && f.getDenominator() == 1);
+        }
+    }
+
+    char small[4];
+    assert(toChars(small, small + sizeof small, Fraction(-10, 3)).ec == std::errc::value_too_large);
+}
 
 int main() {
     Fraction f1(10, 7), f2(8, 11), f3;
@@ -24,6 +227,15 @@ int main() {
     f3 = f1 + f2;
     std::cout << "Sum after increments: new f1 + new f2 = " << f3 << "\n";
 
+    checkBasicFraction<Fraction32>();
+    checkBasicFraction<Fraction64>();
+    checkBasicFraction<Fraction128>();
+    checkBasicFraction<BasicFraction<int32_t, Reduction::Lazy>>();
+    checkBasicFraction<BasicFraction<int64_t, Reduction::Lazy>>();
+    checkOverflowDetection();
+    checkBatch();
+    checkCharsIO();
+    std::cout << "\nBasicFraction checks passed\n";
 
     return 0;
 }
@@ -0,0 +1,132 @@
+// IntrusivePtr versus SharedPtr for small "packet" objects:
+//   - heap footprint per owned object (allocations and bytes requested),
+//   - copy+destroy of owners spread over many objects in random order,
+//     where SharedPtr has to visit the control block and the object,
+//   - copy+destroy of one hot object from several threads (atomic count).
+// Global operator new is replaced to count allocations.
+//
+//   g++ -std=c++17 -O2 -pthread -Iinclude bench/intrusive_bench.cpp -o intrusive_bench
+//   ./intrusive_bench [objects] [threads]
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <random>
+#include <thread>
+#include <vector>
+#include "IntrusivePtr.hpp"
+#include "SharedPtr.hpp"
+
+static std::size_t g_allocations = 0;
+static std::size_t g_bytes = 0;
+
+void* operator new(std::size_t n) {
+    ++g_allocations;
+    g_bytes += n;
+    if (void* p = std::malloc(n ? n : 1)) return p;
+    throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+struct Payload {
+    int id = 0;
+    char data[44] = {};
+};
+
+struct Packet : Payload {};
+struct CountedPacket : Payload, RefCounted<CountedPacket> {};
+struct LocalPacket : Payload, RefCounted<LocalPacket, RefCounting::Local> {};
+
+using ms = std::chrono::duration<double, std::milli>;
+
+template <typename Ptr, typename Make>
+static void run(const char* name, std::size_t n, unsigned threads, Make make) {
+    std::vector<Ptr> owners;
+    owners.reserve(n);
+
+    std::size_t allocs = g_allocations, bytes = g_bytes;
+    for (std::size_t i = 0; i < n; ++i) owners.push_back(make(static_cast<int>(i)));
+    allocs = g_allocations - allocs;
+    bytes = g_bytes - bytes;
+
+    // visit objects in random order so every copy is a cache miss
+    std::vector<std::size_t> order(n);
+    for (std::size_t i = 0; i < n; ++i) order[i] = i;
+    std::shuffle(order.begin(), order.end(), std::mt19937(42));
+
+    long long sum = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    for (std::size_t i : order) {
+        Ptr copy(owners[i]);            // increment
+        sum += copy->id;
+    }                                   // decrement
+    auto t1 = std::chrono::steady_clock::now();
+    double scattered = std::chrono::duration<double, std::nano>(t1 - t0).count() / n;
+
+    // one hot object, every thread copying it
+    std::atomic<bool> go{false};
+    std::atomic<long long> sink{0};
+    std::vector<std::thread> pool;
+    for (unsigned t = 0; t < threads; ++t) {
+        pool.emplace_back([&, mine = owners[0]] {
+            while (!go.load(std::memory_order_acquire)) {}
+            long long local = 0;
+            for (std::size_t i = 0; i < n; ++i) {
+                Ptr copy(mine);
+                local += copy->id;
+            }
+            sink += local;
+        });
+    }
+    auto t2 = std::chrono::steady_clock::now();
+    go.store(true, std::memory_order_release);
+    for (auto& th : pool) th.join();
+    double hot = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t2).count() / n;
+
+    auto t3 = std::chrono::steady_clock::now();
+    owners.clear();
+    auto t4 = std::chrono::steady_clock::now();
+
+    std::printf("%-26s %2zu B/ptr %.0f allocs %5.1f B/object | scattered copy %6.2f ns  "
+                "hot copy %6.2f ns  destroy %6.1f ms  [%lld]\n",
+                name, sizeof(Ptr), double(allocs) / n, double(bytes) / n,
+                scattered, hot, ms(t4 - t3).count(), sum + sink.load());
+}
+
+int main(int argc, char** argv) {
+    std::size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 2'000'000;
+    unsigned hw = std::thread::hardware_concurrency();
+    unsigned threads = argc > 2 ? std::atoi(argv[2]) : (hw ? hw : 1);
+    std::printf("%zu objects of %zu payload bytes, %u threads on the hot object\n\n",
+                n, sizeof(Payload), threads);
+
+    // fault the heap in first so the first row does not pay for it
+    { std::vector<SharedPtr<Packet>> warm; for (std::size_t i = 0; i < n; ++i) warm.push_back(SharedPtr<Packet>(new Packet)); }
+
+    run<SharedPtr<Packet>>("SharedPtr(new Packet)", n, threads, [](int v) {
+        SharedPtr<Packet> p(new Packet);
+        p->id = v;
+        return p;
+    });
+    run<SharedPtr<Packet>>("make_shared<Packet>", n, threads, [](int v) {
+        SharedPtr<Packet> p = make_shared<Packet>();
+        p->id = v;
+        return p;
+    });
+    run<IntrusivePtr<CountedPacket>>("IntrusivePtr (atomic)", n, threads, [](int v) {
+        IntrusivePtr<CountedPacket> p = make_intrusive<CountedPacket>();
+        p->id = v;
+        return p;
+    });
+    run<IntrusivePtr<LocalPacket>>("IntrusivePtr (local)", n, 1, [](int v) {
+        IntrusivePtr<LocalPacket> p = make_intrusive<LocalPacket>();
+        p->id = v;
+        return p;
+    });
+    std::printf("\nIntrusivePtr (local) is single-threaded only, so its hot row uses 1 thread.\n");
+    return 0;
+}
@@ -0,0 +1,63 @@
+// Heap allocations per owner and time to create and destroy 10M owners:
+// SharedPtr(new int) (value and control block allocated separately) versus
+// make_shared (one block), with std::make_shared as a reference.
+// Global operator new is replaced to count allocations.
+//
+//   g++ -std=c++17 -O2 -Iinclude bench/make_shared_bench.cpp -o make_shared_bench
+//   ./make_shared_bench [owners]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <vector>
+#include "SharedPtr.hpp"
+
+static std::size_t g_allocations = 0;
+
+void* operator new(std::size_t n) {
+    ++g_allocations;
+    if (void* p = std::malloc(n ? n : 1)) return p;
+    throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+// Keeps all owners alive at once, then reads each through the pointer
+// (count and value) and destroys them, like a cache being torn down.
+template <typename Ptr, typename Make>
+static void run(const char* name, std::size_t n, Make make) {
+    std::vector<Ptr> owners;
+    owners.reserve(n);
+
+    std::size_t before = g_allocations;
+    auto t0 = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < n; ++i) owners.push_back(make(static_cast<int>(i)));
+    auto t1 = std::chrono::steady_clock::now();
+    std::size_t allocs = g_allocations - before;
+
+    long long sum = 0;
+    for (const Ptr& p : owners) sum += *p;
+    auto t2 = std::chrono::steady_clock::now();
+    owners.clear();
+    auto t3 = std::chrono::steady_clock::now();
+
+    using ms = std::chrono::duration<double, std::milli>;
+    std::printf("%-26s %.2f allocs/owner | create %7.1f ms  read %6.1f ms  destroy %7.1f ms  [%lld]\n",
+                name, double(allocs) / n, ms(t1 - t0).count(), ms(t2 - t1).count(),
+                ms(t3 - t2).count(), sum);
+}
+
+int main(int argc, char** argv) {
+    std::size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10'000'000;
+    std::printf("%zu owners\n\n", n);
+
+    // fault the heap in first so the first row does not pay for it
+    { std::vector<SharedPtr<int>> warm; for (std::size_t i = 0; i < n; ++i) warm.push_back(SharedPtr<int>(new int)); }
+
+    run<SharedPtr<int>>("SharedPtr(new int)", n, [](int v) { return SharedPtr<int>(new int(v)); });
+    run<SharedPtr<int>>("make_shared", n, [](int v) { return make_shared<int>(v); });
+    run<std::shared_ptr<int>>("std::make_shared", n, [](int v) { return std::make_shared<int>(v); });
+    return 0;
+}
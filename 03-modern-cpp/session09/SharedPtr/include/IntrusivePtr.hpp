@@ -0,0 +1,246 @@
+#ifndef INTRUSIVE_PTR_HPP
+#define INTRUSIVE_PTR_HPP
+
+#include <atomic>
+#include <type_traits>
+#include <utility>
+
+/// Whether an intrusive count may be shared across threads
+enum class RefCounting { Atomic, Local };
+
+/// Base class that stores the reference count inside the object itself:
+///
+///     struct Packet : RefCounted<Packet> { ... };
+///
+/// Compared with SharedPtr there is no control block, so creating an
+/// owned object is a single allocation of exactly sizeof(Packet), and
+/// copying a pointer touches the count that sits next to the data.
+/// RefCounting::Local drops the atomic RMW for objects that never leave
+/// one thread.
+///
+/// The count starts at zero; IntrusivePtr adopts the object by adding
+/// the first reference. When the last reference goes, the object is
+/// destroyed with `delete` as a Derived, so Derived needs no virtual
+/// destructor.
+template <typename Derived, RefCounting C = RefCounting::Atomic>
+class RefCounted {
+public:
+    void add_ref() const noexcept;
+    void release() const noexcept;
+    int use_count() const noexcept;
+
+protected:
+    RefCounted() noexcept = default;
+    ~RefCounted() = default;
+
+    // a copied object is a new object with its own owners
+    RefCounted(const RefCounted&) noexcept {}
+    RefCounted& operator=(const RefCounted&) noexcept { return *this; }
+
+private:
+    using Count = std::conditional_t<C == RefCounting::Atomic, std::atomic<int>, int>;
+    mutable Count refs_{0};
+};
+
+/// Smart pointer to objects that carry their own count: anything with
+/// add_ref(), release() and use_count() members, typically by deriving
+/// from RefCounted. Same ergonomics as SharedPtr; the object can also be
+/// handed around as a raw pointer and re-adopted without losing track
+/// of its owners, since the count travels with it.
+template <typename T>
+class IntrusivePtr {
+public:
+    using element_type = T;
+
+    /// Empty pointer
+    IntrusivePtr() noexcept;
+
+    /// Takes a reference to ptr (which may already have other owners)
+    explicit IntrusivePtr(T* ptr) noexcept;
+
+    IntrusivePtr(const IntrusivePtr& other) noexcept;
+    template <typename Y, typename = std::enable_if_t<std::is_convertible_v<Y*, T*>>>
+    IntrusivePtr(const IntrusivePtr<Y>& other) noexcept;
+
+    IntrusivePtr(IntrusivePtr&& other) noexcept;
+    template <typename Y, typename = std::enable_if_t<std::is_convertible_v<Y*, T*>>>
+    IntrusivePtr(IntrusivePtr<Y>&& other) noexcept;
+
+    IntrusivePtr& operator=(const IntrusivePtr& other) noexcept;
+    IntrusivePtr& operator=(IntrusivePtr&& other) noexcept;
+
+    /// Drops our reference; the last one destroys the object
+    ~IntrusivePtr();
+
+    /// Drops our reference, leaving this pointer empty
+    void reset() noexcept;
+
+    /// Drops our reference and takes one to ptr
+    void reset(T* ptr) noexcept;
+
+    /// Returns the raw pointer
+    T* get() const noexcept;
+
+    /// Current number of owners (or –1 if empty)
+    int get_count() const noexcept;
+
+    T& operator*() const noexcept;
+    T* operator->() const noexcept;
+    explicit operator bool() const noexcept;
+
+    void swap(IntrusivePtr& other) noexcept;
+
+private:
+    template <typename> friend class IntrusivePtr;
+
+    T* res_;
+};
+
+/// Allocates T and returns its first owner
+template <typename T, typename... Args>
+IntrusivePtr<T> make_intrusive(Args&&... args);
+
+//–– RefCounted ––//
+
+template <typename Derived, RefCounting C>
+void RefCounted<Derived, C>::add_ref() const noexcept {
+    if constexpr (C == RefCounting::Atomic)
+        refs_.fetch_add(1, std::memory_order_relaxed);
+    else
+        ++refs_;
+}
+
+template <typename Derived, RefCounting C>
+void RefCounted<Derived, C>::release() const noexcept {
+    if constexpr (C == RefCounting::Atomic) {
+        // same ordering as SharedPtr: release on every drop, acquire
+        // before the last owner destroys the object
+        if (refs_.fetch_sub(1, std::memory_order_release) == 1) {
+            std::atomic_thread_fence(std::memory_order_acquire);
+            delete static_cast<const Derived*>(this);
+        }
+    } else {
+        if (--refs_ == 0)
+            delete static_cast<const Derived*>(this);
+    }
+}
+
+template <typename Derived, RefCounting C>
+int RefCounted<Derived, C>::use_count() const noexcept {
+    if constexpr (C == RefCounting::Atomic)
+        return refs_.load(std::memory_order_relaxed);
+    else
+        return refs_;
+}
+
+//–– IntrusivePtr ––//
+
+template <typename T>
+IntrusivePtr<T>::IntrusivePtr() noexcept
+  : res_(nullptr)
+{}
+
+template <typename T>
+IntrusivePtr<T>::IntrusivePtr(T* ptr) noexcept
+  : res_(ptr)
+{
+    if (res_) res_->add_ref();
+}
+
+template <typename T>
+IntrusivePtr<T>::IntrusivePtr(const IntrusivePtr& other) noexcept
+  : IntrusivePtr(other.res_)
+{}
+
+template <typename T>
+template <typename Y, typename>
+IntrusivePtr<T>::IntrusivePtr(const IntrusivePtr<Y>& other) noexcept
+  : IntrusivePtr(static_cast<T*>(other.res_))
+{}
+
+template <typename T>
+IntrusivePtr<T>::IntrusivePtr(IntrusivePtr&& other) noexcept
+  : res_(std::exchange(other.res_, nullptr))
+{}
+
+template <typename T>
+template <typename Y, typename>
+IntrusivePtr<T>::IntrusivePtr(IntrusivePtr<Y>&& other) noexcept
+  : res_(std::exchange(other.res_, nullptr))
+{}
+
+template <typename T>
+IntrusivePtr<T>& IntrusivePtr<T>::operator=(const IntrusivePtr& other) noexcept
+{
+    IntrusivePtr(other).swap(*this);
+    return *this;
+}
+
+template <typename T>
+IntrusivePtr<T>& IntrusivePtr<T>::operator=(IntrusivePtr&& other) noexcept
+{
+    IntrusivePtr(std::move(other)).swap(*this);
+    return *this;
+}
+
+template <typename T>
+IntrusivePtr<T>::~IntrusivePtr()
+{
+    if (res_) res_->release();
+}
+
+template <typename T>
+void IntrusivePtr<T>::reset() noexcept
+{
+    IntrusivePtr().swap(*this);
+}
+
+template <typename T>
+void IntrusivePtr<T>::reset(T* ptr) noexcept
+{
+    IntrusivePtr(ptr).swap(*this);
+}
+
+template <typename T>
+T* IntrusivePtr<T>::get() const noexcept
+{
+    return res_;
+}
+
+template <typename T>
+int IntrusivePtr<T>::get_count() const noexcept
+{
+    return res_ ? res_->use_count() : -1;
+}
+
+template <typename T>
+T& IntrusivePtr<T>::operator*() const noexcept
+{
+    return *res_;
+}
+
+template <typename T>
+T* IntrusivePtr<T>::operator->() const noexcept
+{
+    return res_;
+}
+
+template <typename T>
+IntrusivePtr<T>::operator bool() const noexcept
+{
+    return res_ != nullptr;
+}
+
+template <typename T>
+void IntrusivePtr<T>::swap(IntrusivePtr& other) noexcept
+{
+    std::swap(res_, other.res_);
+}
+
+template <typename T, typename... Args>
+IntrusivePtr<T> make_intrusive(Args&&... args)
+{
+    return IntrusivePtr<T>(new T(std::forward<Args>(args)...));
+}
+
+#endif // INTRUSIVE_PTR_HPP
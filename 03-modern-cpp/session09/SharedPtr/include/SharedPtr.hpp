@@ -1,53 +1,570 @@
 #ifndef SHARED_PTR_HPP
 #define SHARED_PTR_HPP
 
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
 #include <utility>
 
+template <typename T> class SharedPtr;
+template <typename T> class WeakPtr;
+
+/// Bookkeeping shared by every SharedPtr/WeakPtr of one object.
+///
+/// shared_ counts SharedPtr owners; the object is destroyed when it drops
+/// to zero. weak_ counts WeakPtr observers plus one for the shared owners
+/// as a group; the block itself is freed when that drops to zero. The
+/// concrete block decides how the object is destroyed and where it lives
+/// (separately with a deleter, or inline right after the counts).
+class ControlBlock {
+public:
+    ControlBlock() = default;
+    ControlBlock(const ControlBlock&) = delete;
+    ControlBlock& operator=(const ControlBlock&) = delete;
+
+    void add_shared() noexcept;
+    void release_shared() noexcept;
+    /// Adds an owner only if the object is still alive (WeakPtr::lock)
+    bool try_add_shared() noexcept;
+    int shared_count() const noexcept;
+
+    void add_weak() noexcept;
+    void release_weak() noexcept;
+
+protected:
+    virtual ~ControlBlock() = default;
+
+private:
+    std::atomic<int> shared_{1};
+    std::atomic<int> weak_{1};
+
+    /// Destroys the managed object (last SharedPtr gone)
+    virtual void dispose() noexcept = 0;
+    /// Frees the block itself (last SharedPtr and WeakPtr gone)
+    virtual void destroy() noexcept = 0;
+};
+
+/// Block for an object allocated elsewhere, released through a deleter
+/// stored inside the block (type-erased: it does not show up in
+/// SharedPtr<T>'s type).
+template <typename Y, typename D>
+class PointerControlBlock final : public ControlBlock {
+public:
+    PointerControlBlock(Y* p, D d);
+
+private:
+    Y* ptr_;
+    D  deleter_;
+
+    void dispose() noexcept override;
+    void destroy() noexcept override;
+};
+
+/// Block created by make_shared: the object lives inside the block, so
+/// object and counts come from a single allocation.
+template <typename T>
+class InlineControlBlock final : public ControlBlock {
+public:
+    template <typename... Args>
+    explicit InlineControlBlock(Args&&... args);
+
+    T* get() noexcept;
+
+private:
+    alignas(T) unsigned char storage_[sizeof(T)];
+
+    void dispose() noexcept override;
+    void destroy() noexcept override;
+};
+
+/// Distinct SharedPtr objects sharing one object may be copied and
+/// destroyed from different threads concurrently (the counts are atomic).
+/// As with std::shared_ptr, one SharedPtr object must not be written by
+/// one thread while other threads access it.
+template <typename T>
 class SharedPtr {
 public:
-    /// Constructs a SharedPtr owning ptr (or null if no ptr given)
-    explicit SharedPtr(int* ptr = nullptr);
+    using element_type = T;
 
-    /// Copy ctor: increments shared count
-    SharedPtr(const SharedPtr& other);
+    /// Empty pointer: no object, no control block
+    SharedPtr() noexcept;
+    constexpr SharedPtr(std::nullptr_t) noexcept;
 
-    /// Copy‑assignment: release current, then copy + increment
-    SharedPtr& operator=(const SharedPtr& other);
+    /// Owns ptr, released with `delete ptr` when the last owner goes away
+    template <typename Y>
+    explicit SharedPtr(Y* ptr);
+
+    /// Owns ptr, released with d(ptr); d is kept in the control block
+    template <typename Y, typename D>
+    SharedPtr(Y* ptr, D d);
+
+    /// Aliasing: shares ownership with r but points at ptr (e.g. a member
+    /// of r's object). ptr stays valid for as long as r's object lives.
+    template <typename Y>
+    SharedPtr(const SharedPtr<Y>& r, T* ptr) noexcept;
+    template <typename Y>
+    SharedPtr(SharedPtr<Y>&& r, T* ptr) noexcept;
+
+    /// Copy ctor: increments shared count
+    SharedPtr(const SharedPtr& other) noexcept;
+    template <typename Y, typename = std::enable_if_t<std::is_convertible_v<Y*, T*>>>
+    SharedPtr(const SharedPtr<Y>& other) noexcept;
 
     /// Move ctor: steals ownership (source reset to null)
-    SharedPtr(SharedPtr&& other);
+    SharedPtr(SharedPtr&& other) noexcept;
+    template <typename Y, typename = std::enable_if_t<std::is_convertible_v<Y*, T*>>>
+    SharedPtr(SharedPtr<Y>&& other) noexcept;
+
+    /// Copy‑assignment: release current, then copy + increment
+    SharedPtr& operator=(const SharedPtr& other) noexcept;
 
     /// Move‑assignment: release current, then steal (source reset)
-    SharedPtr& operator=(SharedPtr&& other);
+    SharedPtr& operator=(SharedPtr&& other) noexcept;
 
     /// Destructor: decrements count, deletes when reaching zero
     ~SharedPtr();
 
+    /// Releases ownership, leaving this pointer empty
+    void reset() noexcept;
+    void reset(std::nullptr_t) noexcept;
+
     /// Resets to own ptr (releasing old), count starts at 1
-    void reset(int* ptr = nullptr);
+    template <typename Y>
+    void reset(Y* ptr);
+    template <typename Y, typename D>
+    void reset(Y* ptr, D d);
 
     /// Returns the raw pointer
-    int* get() const;
+    T* get() const noexcept;
 
-    /// Overwrites *get() with val
-    void set(int val);
+    /// Overwrites *get() with val (not for SharedPtr<void>)
+    template <typename U = T>
+    void set(const std::enable_if_t<!std::is_void_v<U>, U>& val);
 
     /// Returns current shared‑owner count (or –1 if none)
-    int get_count() const;
+    int get_count() const noexcept;
 
-    /// Dereference operators
-    int& operator*() const;
-    int* operator->() const;
+    /// Dereference operators (operator* not for SharedPtr<void>)
+    template <typename U = T, typename = std::enable_if_t<!std::is_void_v<U>>>
+    U& operator*() const noexcept;
+    T* operator->() const noexcept;
 
     /// Allows "if(ptr)" and static_cast<bool>(ptr)
-    explicit operator bool() const;
+    explicit operator bool() const noexcept;
+
+    void swap(SharedPtr& other) noexcept;
 
 private:
-    int* res_;      // the managed pointer
-    int* counter_;  // heap‑allocated reference count
+    template <typename> friend class SharedPtr;
+    template <typename> friend class WeakPtr;
+    template <typename U, typename... Args>
+    friend SharedPtr<U> make_shared(Args&&... args);
 
-    void increment_count();
-    void decrement_count();
+    T*            res_;      // the pointer handed out by get()
+    ControlBlock* counter_;  // shared bookkeeping, or null when empty
+
+    /// Adopts an already counted block (used by make_shared and lock)
+    struct Adopt {};
+    SharedPtr(Adopt, T* ptr, ControlBlock* block) noexcept;
 };
 
+template <typename T>
+SharedPtr(T*) -> SharedPtr<T>;
+
+/// Builds T in place inside its control block: one allocation for the
+/// object and its counts instead of two
+template <typename T, typename... Args>
+SharedPtr<T> make_shared(Args&&... args);
+
+/// Non-owning observer of an object managed by SharedPtr. It never keeps
+/// the object alive, so it can break reference cycles or watch cache
+/// entries; lock() turns it into a real owner if the object still exists.
+template <typename T>
+class WeakPtr {
+public:
+    WeakPtr() noexcept;
+    template <typename Y, typename = std::enable_if_t<std::is_convertible_v<Y*, T*>>>
+    WeakPtr(const SharedPtr<Y>& owner) noexcept;
+
+    WeakPtr(const WeakPtr& other) noexcept;
+    WeakPtr(WeakPtr&& other) noexcept;
+    WeakPtr& operator=(const WeakPtr& other) noexcept;
+    WeakPtr& operator=(WeakPtr&& other) noexcept;
+    ~WeakPtr();
+
+    void reset() noexcept;
+
+    /// True once the last SharedPtr owner is gone
+    bool expired() const noexcept;
+
+    /// An owning pointer to the object, or an empty one if it expired
+    SharedPtr<T> lock() const noexcept;
+
+    /// Current shared‑owner count (0 if expired or empty)
+    int get_count() const noexcept;
+
+    void swap(WeakPtr& other) noexcept;
+
+private:
+    T*            res_;
+    ControlBlock* counter_;
+};
+
+//–– ControlBlock ––//
+
+inline void ControlBlock::add_shared() noexcept {
+    // a new owner is always made from an existing one, which keeps the
+    // object alive, so nothing needs ordering here
+    shared_.fetch_add(1, std::memory_order_relaxed);
+}
+
+inline void ControlBlock::release_shared() noexcept {
+    // release: our writes to the object happen before the count drops;
+    // acquire (last owner only): all other owners' writes are visible
+    // before the object is destroyed
+    if (shared_.fetch_sub(1, std::memory_order_release) == 1) {
+        std::atomic_thread_fence(std::memory_order_acquire);
+        dispose();
+        // No WeakPtr left means none can appear any more (they are made
+        // from owners or other WeakPtrs), so skip the second atomic RMW
+        if (weak_.load(std::memory_order_acquire) == 1) destroy();
+        else release_weak();
+    }
+}
+
+inline bool ControlBlock::try_add_shared() noexcept {
+    int n = shared_.load(std::memory_order_relaxed);
+    while (n != 0) {
+        if (shared_.compare_exchange_weak(n, n + 1, std::memory_order_acq_rel,
+                                          std::memory_order_relaxed))
+            return true;
+    }
+    return false;
+}
+
+inline int ControlBlock::shared_count() const noexcept {
+    return shared_.load(std::memory_order_relaxed);
+}
+
+inline void ControlBlock::add_weak() noexcept {
+    weak_.fetch_add(1, std::memory_order_relaxed);
+}
+
+inline void ControlBlock::release_weak() noexcept {
+    if (weak_.fetch_sub(1, std::memory_order_release) == 1) {
+        std::atomic_thread_fence(std::memory_order_acquire);
+        destroy();
+    }
+}
+
+template <typename Y, typename D>
+PointerControlBlock<Y, D>::PointerControlBlock(Y* p, D d)
+  : ptr_(p),
+    deleter_(std::move(d))
+{}
+
+template <typename Y, typename D>
+void PointerControlBlock<Y, D>::dispose() noexcept {
+    deleter_(ptr_);
+}
+
+template <typename Y, typename D>
+void PointerControlBlock<Y, D>::destroy() noexcept {
+    delete this;
+}
+
+template <typename T>
+template <typename... Args>
+InlineControlBlock<T>::InlineControlBlock(Args&&... args)
+{
+    ::new (static_cast<void*>(storage_)) T(std::forward<Args>(args)...);
+}
+
+template <typename T>
+T* InlineControlBlock<T>::get() noexcept {
+    return std::launder(reinterpret_cast<T*>(storage_));
+}
+
+template <typename T>
+void InlineControlBlock<T>::dispose() noexcept {
+    get()->~T();
+}
+
+template <typename T>
+void InlineControlBlock<T>::destroy() noexcept {
+    delete this;
+}
+
+//–– SharedPtr ––//
+
+template <typename T>
+SharedPtr<T>::SharedPtr() noexcept
+  : res_(nullptr),
+    counter_(nullptr)
+{}
+
+template <typename T>
+constexpr SharedPtr<T>::SharedPtr(std::nullptr_t) noexcept
+  : res_(nullptr),
+    counter_(nullptr)
+{}
+
+template <typename T>
+template <typename Y>
+SharedPtr<T>::SharedPtr(Y* ptr)
+  : SharedPtr(ptr, std::default_delete<Y>())
+{}
+
+template <typename T>
+template <typename Y, typename D>
+SharedPtr<T>::SharedPtr(Y* ptr, D d)
+  : res_(ptr),
+    counter_(nullptr)
+{
+    try {
+        counter_ = new PointerControlBlock<Y, D>(ptr, d);
+    } catch (...) {
+        d(ptr);     // we were handed ownership: do not leak on failure
+        throw;
+    }
+}
+
+template <typename T>
+template <typename Y>
+SharedPtr<T>::SharedPtr(const SharedPtr<Y>& r, T* ptr) noexcept
+  : res_(ptr),
+    counter_(r.counter_)
+{
+    if (counter_) counter_->add_shared();
+}
+
+template <typename T>
+template <typename Y>
+SharedPtr<T>::SharedPtr(SharedPtr<Y>&& r, T* ptr) noexcept
+  : res_(ptr),
+    counter_(std::exchange(r.counter_, nullptr))
+{
+    r.res_ = nullptr;
+}
+
+template <typename T>
+SharedPtr<T>::SharedPtr(const SharedPtr& other) noexcept
+  : res_(other.res_),
+    counter_(other.counter_)
+{
+    if (counter_) counter_->add_shared();
+}
+
+template <typename T>
+template <typename Y, typename>
+SharedPtr<T>::SharedPtr(const SharedPtr<Y>& other) noexcept
+  : res_(other.res_),
+    counter_(other.counter_)
+{
+    if (counter_) counter_->add_shared();
+}
+
+template <typename T>
+SharedPtr<T>::SharedPtr(SharedPtr&& other) noexcept
+  : res_(std::exchange(other.res_, nullptr)),
+    counter_(std::exchange(other.counter_, nullptr))
+{}
+
+template <typename T>
+template <typename Y, typename>
+SharedPtr<T>::SharedPtr(SharedPtr<Y>&& other) noexcept
+  : res_(std::exchange(other.res_, nullptr)),
+    counter_(std::exchange(other.counter_, nullptr))
+{}
+
+template <typename T>
+SharedPtr<T>::SharedPtr(Adopt, T* ptr, ControlBlock* block) noexcept
+  : res_(ptr),
+    counter_(block)
+{}
+
+template <typename T>
+SharedPtr<T>& SharedPtr<T>::operator=(const SharedPtr& other) noexcept
+{
+    SharedPtr(other).swap(*this);
+    return *this;
+}
+
+template <typename T>
+SharedPtr<T>& SharedPtr<T>::operator=(SharedPtr&& other) noexcept
+{
+    SharedPtr(std::move(other)).swap(*this);
+    return *this;
+}
+
+template <typename T>
+SharedPtr<T>::~SharedPtr()
+{
+    if (counter_) counter_->release_shared();
+}
+
+template <typename T>
+void SharedPtr<T>::reset() noexcept
+{
+    SharedPtr().swap(*this);
+}
+
+template <typename T>
+void SharedPtr<T>::reset(std::nullptr_t) noexcept
+{
+    reset();
+}
+
+template <typename T>
+template <typename Y>
+void SharedPtr<T>::reset(Y* ptr)
+{
+    SharedPtr(ptr).swap(*this);
+}
+
+template <typename T>
+template <typename Y, typename D>
+void SharedPtr<T>::reset(Y* ptr, D d)
+{
+    SharedPtr(ptr, std::move(d)).swap(*this);
+}
+
+template <typename T>
+T* SharedPtr<T>::get() const noexcept
+{
+    return res_;
+}
+
+template <typename T>
+template <typename U>
+void SharedPtr<T>::set(const std::enable_if_t<!std::is_void_v<U>, U>& val)
+{
+    if (res_) *res_ = val;
+}
+
+template <typename T>
+int SharedPtr<T>::get_count() const noexcept
+{
+    return counter_ ? counter_->shared_count() : -1;
+}
+
+template <typename T>
+template <typename U, typename>
+U& SharedPtr<T>::operator*() const noexcept
+{
+    return *res_;
+}
+
+template <typename T>
+T* SharedPtr<T>::operator->() const noexcept
+{
+    return res_;
+}
+
+template <typename T>
+SharedPtr<T>::operator bool() const noexcept
+{
+    return res_ != nullptr;
+}
+
+template <typename T>
+void SharedPtr<T>::swap(SharedPtr& other) noexcept
+{
+    std::swap(res_, other.res_);
+    std::swap(counter_, other.counter_);
+}
+
+template <typename T, typename... Args>
+SharedPtr<T> make_shared(Args&&... args)
+{
+    auto* block = new InlineControlBlock<T>(std::forward<Args>(args)...);
+    return SharedPtr<T>(typename SharedPtr<T>::Adopt{}, block->get(), block);
+}
+
+//–– WeakPtr ––//
+
+template <typename T>
+WeakPtr<T>::WeakPtr() noexcept
+  : res_(nullptr),
+    counter_(nullptr)
+{}
+
+template <typename T>
+template <typename Y, typename>
+WeakPtr<T>::WeakPtr(const SharedPtr<Y>& owner) noexcept
+  : res_(owner.res_),
+    counter_(owner.counter_)
+{
+    if (counter_) counter_->add_weak();
+}
+
+template <typename T>
+WeakPtr<T>::WeakPtr(const WeakPtr& other) noexcept
+  : res_(other.res_),
+    counter_(other.counter_)
+{
+    if (counter_) counter_->add_weak();
+}
+
+template <typename T>
+WeakPtr<T>::WeakPtr(WeakPtr&& other) noexcept
+  : res_(std::exchange(other.res_, nullptr)),
+    counter_(std::exchange(other.counter_, nullptr))
+{}
+
+template <typename T>
+WeakPtr<T>& WeakPtr<T>::operator=(const WeakPtr& other) noexcept
+{
+    WeakPtr(other).swap(*this);
+    return *this;
+}
+
+template <typename T>
+WeakPtr<T>& WeakPtr<T>::operator=(WeakPtr&& other) noexcept
+{
+    WeakPtr(std::move(other)).swap(*this);
+    return *this;
+}
+
+template <typename T>
+WeakPtr<T>::~WeakPtr()
+{
+    if (counter_) counter_->release_weak();
+}
+
+template <typename T>
+void WeakPtr<T>::reset() noexcept
+{
+    WeakPtr().swap(*this);
+}
+
+template <typename T>
+bool WeakPtr<T>::expired() const noexcept
+{
+    return get_count() == 0;
+}
+
+template <typename T>
+SharedPtr<T> WeakPtr<T>::lock() const noexcept
+{
+    if (counter_ && counter_->try_add_shared())
+        return SharedPtr<T>(typename SharedPtr<T>::Adopt{}, res_, counter_);
+    return SharedPtr<T>();
+}
+
+template <typename T>
+int WeakPtr<T>::get_count() const noexcept
+{
+    return counter_ ? counter_->shared_count() : 0;
+}
+
+template <typename T>
+void WeakPtr<T>::swap(WeakPtr& other) noexcept
+{
+    std::swap(res_, other.res_);
+    std::swap(counter_, other.counter_);
+}
+
 #endif // SHARED_PTR_HPP
@@ -1,9 +1,14 @@
 #include <iostream>
 #include <cassert>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
 #include "SharedPtr.hpp"
+#include "IntrusivePtr.hpp"
 
 void testConstruction() {
-    SharedPtr p(new int(5));
+    SharedPtr<int> p(new int(5));
     assert(p);                           // operator bool
     assert(p.get_count() == 1);          // single owner
     assert(*p == 5);                     // value check
@@ -11,8 +16,8 @@ void testConstruction() {
 }
 
 void testCopy() {
-    SharedPtr p1(new int(42));
-    SharedPtr p2(p1);                    // copy ctor
+    SharedPtr<int> p1(new int(42));
+    SharedPtr<int> p2(p1);                    // copy ctor
     assert(p1.get_count() == 2);
     assert(p2.get_count() == 2);
     assert(*p2 == 42);
@@ -20,8 +25,8 @@ void testCopy() {
 }
 
 void testCopyAssignment() {
-    SharedPtr p1(new int(7));
-    SharedPtr p2;
+    SharedPtr<int> p1(new int(7));
+    SharedPtr<int> p2;
     p2 = p1;                             // copy assignment
     assert(p1.get_count() == 2);
     assert(p2.get_count() == 2);
@@ -30,15 +35,15 @@ void testCopyAssignment() {
 }
 
 void testMove() {
-    SharedPtr p1(new int(99));
-    SharedPtr p2(std::move(p1));        // move ctor
+    SharedPtr<int> p1(new int(99));
+    SharedPtr<int> p2(std::move(p1));        // move ctor
     assert(p2.get_count() == 1);
     assert(!p1);                        // p1 should be empty
     assert(p1.get_count() == -1);
     std::cout << "[PASS] Move-construction\n";
 
-    SharedPtr p3(new int(1));
-    SharedPtr p4;
+    SharedPtr<int> p3(new int(1));
+    SharedPtr<int> p4;
     p4 = std::move(p3);                 // move assignment
     assert(p4.get_count() == 1);
     assert(!p3);
@@ -46,21 +51,236 @@ void testMove() {
 }
 
 void testReset() {
-    SharedPtr p(new int(13));
+    SharedPtr<int> p(new int(13));
     p.reset(new int(31));
     assert(p.get_count() == 1);
     assert(*p == 31);
     std::cout << "[PASS] Reset\n";
+
+    // nullptr, as with std::shared_ptr
+    SharedPtr<int> n1(nullptr);
+    SharedPtr<int> n2 = nullptr;
+    assert(!n1 && !n2 && n1.get_count() == -1);
+    p.reset(nullptr);
+    assert(!p && p.get_count() == -1);
+    p = nullptr;
+    assert(!p);
+    std::cout << "[PASS] Reset to nullptr\n";
 }
 
 void testSelfAssignment() {
-    SharedPtr p(new int(123));
+    SharedPtr<int> p(new int(123));
     p = p;                               // no-op
     assert(p.get_count() == 1);
     assert(*p == 123);
     std::cout << "[PASS] Self-assignment\n";
 }
 
+void testMakeShared() {
+    SharedPtr<int> p = make_shared<int>(21);
+    assert(p && *p == 21);
+    assert(p.get_count() == 1);
+
+    SharedPtr<int> q(p);
+    assert(q.get_count() == 2 && q.get() == p.get());
+    *q = 42;
+    assert(*p == 42);
+
+    p.reset(new int(1));                // raw-pointer owners still work
+    assert(p.get_count() == 1 && *p == 1);
+    assert(q.get_count() == 1 && *q == 42);
+
+    SharedPtr<int> zero = make_shared<int>();
+    assert(*zero == 0);
+    std::cout << "[PASS] make_shared\n";
+}
+
+void testWeakPtr() {
+    WeakPtr<int> w;
+    assert(w.expired() && !w.lock());
+
+    {
+        SharedPtr<int> p(new int(8));
+        w = WeakPtr<int>(p);
+        assert(!w.expired());
+        assert(p.get_count() == 1);          // observers do not own
+
+        SharedPtr<int> locked = w.lock();
+        assert(locked && *locked == 8);
+        assert(p.get_count() == 2);
+    }
+    assert(w.expired());                     // last owner gone
+    assert(!w.lock() && w.get_count() == 0);
+
+    SharedPtr<int> m = make_shared<int>(3);
+    WeakPtr<int> wm(m);
+    WeakPtr<int> wm2(wm);
+    m.reset();                               // value destroyed, block kept
+    assert(wm.expired() && wm2.expired());
+    std::cout << "[PASS] WeakPtr\n";
+}
+
+struct CountingDeleter {
+    int* calls;
+    void operator()(int* p) const { ++*calls; delete p; }
+};
+
+void testCustomDeleter() {
+    int calls = 0;
+    {
+        SharedPtr<int> p(new int(4), CountingDeleter{&calls});
+        SharedPtr<int> q(p);
+        assert(calls == 0);
+    }
+    assert(calls == 1);                      // once, by the last owner
+
+    {
+        // the deleter's type does not leak into SharedPtr's type
+        std::FILE* f = std::tmpfile();
+        SharedPtr<std::FILE> file(f, [](std::FILE* fp) { std::fclose(fp); });
+        SharedPtr<int> p;
+        p.reset(new int(5), CountingDeleter{&calls});
+        p = SharedPtr<int>(new int(6), [](int* q) { delete q; });
+        assert(calls == 2);
+    }
+    std::cout << "[PASS] Custom deleters\n";
+}
+
+struct Pair {
+    std::string first;
+    int second;
+};
+
+void testAliasing() {
+    SharedPtr<Pair> owner = make_shared<Pair>(Pair{"key", 9});
+    SharedPtr<int> member(owner, &owner->second);
+    assert(owner.get_count() == 2);          // one control block for both
+    assert(*member == 9);
+
+    owner.reset();
+    assert(member.get_count() == 1 && *member == 9);  // still alive
+
+    WeakPtr<int> w(member);
+    member.reset();
+    assert(w.expired());
+    std::cout << "[PASS] Aliasing\n";
+}
+
+struct Base {
+    virtual ~Base() = default;
+    virtual int id() const { return 1; }
+};
+struct Derived : Base {
+    static inline int destroyed = 0;
+    ~Derived() override { ++destroyed; }
+    int id() const override { return 2; }
+};
+
+void testConversions() {
+    {
+        SharedPtr<Derived> d(new Derived);
+        SharedPtr<Base> b(d);
+        assert(b->id() == 2 && b.get_count() == 2);
+
+        SharedPtr<Base> moved(std::move(d));
+        assert(!d && moved.get_count() == 2);
+
+        WeakPtr<Base> wb(moved);
+        assert(wb.lock()->id() == 2);
+    }
+    assert(Derived::destroyed == 1);
+    std::cout << "[PASS] Derived-to-base conversions\n";
+}
+
+void testVoid() {
+    {
+        // the control block still deletes a Derived, not a void
+        SharedPtr<void> v(new Derived);
+        SharedPtr<void> copy = v;
+        assert(v.get() && copy.get_count() == 2);
+
+        SharedPtr<int> i = make_shared<int>(3);
+        SharedPtr<void> erased(i);
+        WeakPtr<void> w(erased);
+        assert(erased.get() == i.get() && w.lock().get_count() == 3);
+    }
+    assert(Derived::destroyed == 2);
+    std::cout << "[PASS] SharedPtr<void>\n";
+}
+
+struct Packet : RefCounted<Packet> {
+    static inline int alive = 0;
+    int id;
+    explicit Packet(int i) : id(i) { ++alive; }
+    Packet(const Packet& o) : RefCounted(o), id(o.id) { ++alive; }
+    ~Packet() { --alive; }
+};
+
+struct LocalPacket : RefCounted<LocalPacket, RefCounting::Local> {
+    int id = 0;
+};
+
+void testIntrusivePtr() {
+    {
+        IntrusivePtr<Packet> p = make_intrusive<Packet>(1);
+        assert(p && p->id == 1);
+        assert(p.get_count() == 1);
+
+        IntrusivePtr<Packet> q(p);
+        assert(q.get_count() == 2 && p.get() == q.get());
+
+        // the count lives in the object: a raw pointer can be re-adopted
+        IntrusivePtr<Packet> r(p.get());
+        assert(p.get_count() == 3);
+
+        Packet copy(*p);                      // copies start unowned
+        assert(copy.use_count() == 0);
+
+        q.reset();
+        assert(!q && q.get_count() == -1);
+        r = std::move(p);
+        assert(!p && r.get_count() == 1);
+
+        r.reset(new Packet(2));
+        assert(r->id == 2 && r.get_count() == 1);
+        assert(Packet::alive == 2);           // r's packet and copy
+    }
+    assert(Packet::alive == 0);
+
+    IntrusivePtr<LocalPacket> l = make_intrusive<LocalPacket>();
+    IntrusivePtr<LocalPacket> l2 = l;
+    assert(l.get_count() == 2);
+    l = l2;                                   // self-assignment via alias
+    assert(l.get_count() == 2);
+    std::cout << "[PASS] IntrusivePtr\n";
+}
+
+void testConcurrentCopies() {
+    SharedPtr<int> shared(new int(7));
+    WeakPtr<int> observer(shared);
+    const int threads = 8, rounds = 20000;
+
+    std::vector<std::thread> pool;
+    for (int t = 0; t < threads; ++t) {
+        // each thread starts from its own copy, then churns copies of it
+        pool.emplace_back([copy = shared, &observer]() {
+            for (int i = 0; i < rounds; ++i) {
+                SharedPtr<int> a(copy);
+                SharedPtr<int> b;
+                b = a;
+                SharedPtr<int> c(std::move(b));
+                assert(*c == 7);
+                SharedPtr<int> d = observer.lock();
+                assert(d && *d == 7);
+            }
+        });
+    }
+    for (auto& th : pool) th.join();
+
+    assert(shared.get_count() == 1);     // every copy was released
+    std::cout << "[PASS] Concurrent copies\n";
+}
+
 int main() {
     std::cout << "Running SharedPtr tests...\n\n";
     testConstruction();
@@ -69,6 +289,14 @@ int main() {
     testMove();
     testReset();
     testSelfAssignment();
+    testMakeShared();
+    testWeakPtr();
+    testCustomDeleter();
+    testAliasing();
+    testConversions();
+    testVoid();
+    testIntrusivePtr();
+    testConcurrentCopies();
     std::cout << "\nAll tests passed successfully!\n";
     return 0;
 }
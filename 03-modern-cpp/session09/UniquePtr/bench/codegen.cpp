@@ -0,0 +1,61 @@
+// Pairs of functions doing the same job with a raw pointer and with
+// UniquePtr. codegen_check.sh compiles this file with -O2 -S and checks
+// that each unique_* function assembles to the same instructions as its
+// raw_* twin, i.e. that UniquePtr costs nothing over a raw pointer.
+
+#include <cstddef>
+#include <cstdlib>
+#include "UniquePtr.hpp"
+
+extern "C" void consume(int v) noexcept;
+
+extern "C" {
+
+// read through the owner
+int raw_read(int* const& p) { return *p; }
+int unique_read(const UniquePtr<int>& p) { return *p; }
+
+// index an owned array
+int raw_index(int* const& a, std::size_t i) { return a[i]; }
+int unique_index(const UniquePtr<int[]>& a, std::size_t i) { return a[i]; }
+
+// allocate, use, free
+void raw_roundtrip(int v) {
+    int* p = new int(v);
+    consume(*p);
+    delete p;
+}
+void unique_roundtrip(int v) {
+    UniquePtr<int> p(new int(v));
+    consume(*p);
+}
+
+// malloc'd buffer, released with free (UniquePtr, like std::unique_ptr,
+// never passes null to its deleter, so the raw twin checks too)
+void raw_buffer(std::size_t n) {
+    char* p = static_cast<char*>(std::malloc(n));
+    consume(p != nullptr);
+    if (p) std::free(p);
+}
+void unique_buffer(std::size_t n) {
+    UniquePtr<char, FreeDelete> p(static_cast<char*>(std::malloc(n)));
+    consume(p.get() != nullptr);
+}
+
+// hand ownership out to the caller
+int* raw_release(int*& p) {
+    int* r = p;
+    p = nullptr;
+    return r;
+}
+int* unique_release(UniquePtr<int>& p) { return p.release(); }
+
+// replace the owned object
+void raw_replace(int*& slot, int* q) {
+    int* old = slot;
+    slot = q;
+    if (old) delete old;
+}
+void unique_replace(UniquePtr<int>& slot, int* q) { slot.reset(q); }
+
+}
@@ -0,0 +1,38 @@
+#!/bin/sh
+# Compiles bench/codegen.cpp and checks that every unique_* function has
+# the same instructions as its raw_* twin. Run from the UniquePtr folder:
+#
+#   sh bench/codegen_check.sh [compiler flags...]   (default: -O2)
+
+CXX=${CXX:-g++}
+FLAGS=${*:--O2}
+ASM=$(mktemp)
+trap 'rm -f "$ASM"' EXIT
+
+$CXX -std=c++17 $FLAGS -Iinclude -S -fno-asynchronous-unwind-tables \
+    bench/codegen.cpp -o "$ASM" || exit 1
+
+# Instructions of one function, with local labels renamed by first use
+body() {
+    awk -v fn="$1" '
+        $0 == fn":"              { on = 1; next }
+        on && /^\t\.size/        { exit }
+        on && /^\t\./            { next }
+        on                       { print }
+    ' "$ASM" | sed -E 's/\.L[A-Za-z]*[0-9]+/.L/g'
+}
+
+status=0
+for raw in $(grep -E '^raw_[a-z_]+:' "$ASM" | tr -d ':'); do
+    twin=unique_${raw#raw_}
+    if [ "$(body "$raw")" = "$(body "$twin")" ]; then
+        printf '%-16s == %-18s (%s instructions)\n' "$raw" "$twin" "$(body "$raw" | grep -vc ':$')"
+    else
+        printf '%-16s != %s\n' "$raw" "$twin"
+        body "$raw" > "$ASM.raw"; body "$twin" > "$ASM.unique"
+        diff "$ASM.raw" "$ASM.unique" | sed 's/^/    /'
+        rm -f "$ASM.raw" "$ASM.unique"
+        status=1
+    fi
+done
+exit $status
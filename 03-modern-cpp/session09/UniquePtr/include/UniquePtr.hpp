@@ -1,32 +1,419 @@
 #ifndef UNIQUEPTR_HPP
 #define UNIQUEPTR_HPP
 
+#include <cstddef>
+#include <cstdlib>
+#include <type_traits>
 #include <utility>
 
+/// Default deleters: `delete p` and `delete[] p`
+template <typename T>
+struct DefaultDelete {
+    DefaultDelete() noexcept = default;
+    template <typename U, typename = std::enable_if_t<std::is_convertible_v<U*, T*>>>
+    DefaultDelete(const DefaultDelete<U>&) noexcept {}
+
+    void operator()(T* p) const noexcept {
+        static_assert(sizeof(T) > 0, "cannot delete an incomplete type");
+        delete p;
+    }
+};
+
+template <typename T>
+struct DefaultDelete<T[]> {
+    void operator()(T* p) const noexcept {
+        static_assert(sizeof(T) > 0, "cannot delete an incomplete type");
+        delete[] p;
+    }
+};
+
+/// Deleter for buffers that came from malloc/calloc/realloc
+struct FreeDelete {
+    void operator()(void* p) const noexcept { std::free(p); }
+};
+
+namespace unique_ptr_detail {
+
+// D::pointer if the deleter names one (e.g. a file-descriptor handle),
+// otherwise T*
+template <typename T, typename D, typename = void>
+struct pointer_type { using type = T*; };
+
+template <typename T, typename D>
+struct pointer_type<T, D, std::void_t<typename D::pointer>> {
+    using type = typename D::pointer;
+};
+
+// The owned pointer plus its deleter. A stateless deleter becomes an
+// empty base and takes no space, so UniquePtr<T> is exactly one pointer;
+// a stateful one (function pointer, captured state) is stored alongside.
+template <typename P, typename D, bool = std::is_empty_v<D> && !std::is_final_v<D>>
+class Storage : private D {
+public:
+    Storage() noexcept(std::is_nothrow_default_constructible_v<D>) : D(), ptr_() {}
+    template <typename Del>
+    Storage(P p, Del&& d) noexcept : D(std::forward<Del>(d)), ptr_(p) {}
+
+    P& ptr() noexcept { return ptr_; }
+    const P& ptr() const noexcept { return ptr_; }
+    D& deleter() noexcept { return *this; }
+    const D& deleter() const noexcept { return *this; }
+
+private:
+    P ptr_;
+};
+
+template <typename P, typename D>
+class Storage<P, D, false> {
+public:
+    Storage() noexcept(std::is_nothrow_default_constructible_v<D>) : ptr_(), del_() {}
+    template <typename Del>
+    Storage(P p, Del&& d) noexcept : ptr_(p), del_(std::forward<Del>(d)) {}
+
+    P& ptr() noexcept { return ptr_; }
+    const P& ptr() const noexcept { return ptr_; }
+    D& deleter() noexcept { return del_; }
+    const D& deleter() const noexcept { return del_; }
+
+private:
+    P ptr_;
+    D del_;
+};
+
+} // namespace unique_ptr_detail
+
+/// Sole owner of a resource released by D when the UniquePtr goes away.
+/// D may be any callable taking the pointer, e.g. FreeDelete for malloc'd
+/// memory or a deleter with its own `pointer` type for non-pointer
+/// handles. Move-only; with a stateless deleter it is the size of a raw
+/// pointer and compiles to the same code.
+template <typename T, typename D = DefaultDelete<T>>
 class UniquePtr {
 public:
-    explicit UniquePtr(int* ptr = nullptr) noexcept;
+    using pointer      = typename unique_ptr_detail::pointer_type<T, D>::type;
+    using element_type = T;
+    using deleter_type = D;
+
+    static_assert(!std::is_reference_v<D>, "deleter must be an object type");
+
+    UniquePtr() noexcept;
+    UniquePtr(std::nullptr_t) noexcept;
+    explicit UniquePtr(pointer ptr) noexcept;
+    UniquePtr(pointer ptr, const D& d) noexcept;
+    UniquePtr(pointer ptr, D&& d) noexcept;
+
     UniquePtr(const UniquePtr& other) = delete;
     UniquePtr(UniquePtr&& other) noexcept;
 
+    /// Converts from UniquePtr<Derived, E> when pointers and deleters do
+    template <typename U, typename E,
+              typename = std::enable_if_t<!std::is_array_v<U> &&
+                  std::is_convertible_v<typename UniquePtr<U, E>::pointer, pointer> &&
+                  std::is_convertible_v<E, D>>>
+    UniquePtr(UniquePtr<U, E>&& other) noexcept;
+
     UniquePtr& operator=(const UniquePtr& other) = delete;
     UniquePtr& operator=(UniquePtr&& other) noexcept;
+    UniquePtr& operator=(std::nullptr_t) noexcept;
 
     ~UniquePtr();
 
     explicit operator bool() const noexcept;
 
     // dereference
-    int&  operator*()    const;
-    int*  operator->()   const noexcept;
+    std::add_lvalue_reference_t<T> operator*() const;
+    pointer operator->() const noexcept;
 
     // raw access
-    int*  get()          const noexcept;
-    int*  release()      noexcept;
-    void  reset(int* ptr = nullptr) noexcept;
+    pointer get() const noexcept;
+    pointer release() noexcept;
+    void    reset(pointer ptr = pointer()) noexcept;
+    void    swap(UniquePtr& other) noexcept;
+
+    D& get_deleter() noexcept;
+    const D& get_deleter() const noexcept;
 
 private:
-    int* ptr_ = nullptr;
+    unique_ptr_detail::Storage<pointer, D> s_;
 };
 
+/// Array form: releases with delete[] by default and offers operator[]
+/// instead of * and ->
+template <typename T, typename D>
+class UniquePtr<T[], D> {
+public:
+    using pointer      = typename unique_ptr_detail::pointer_type<T, D>::type;
+    using element_type = T;
+    using deleter_type = D;
+
+    static_assert(!std::is_reference_v<D>, "deleter must be an object type");
+
+    UniquePtr() noexcept;
+    UniquePtr(std::nullptr_t) noexcept;
+    explicit UniquePtr(pointer ptr) noexcept;
+    UniquePtr(pointer ptr, const D& d) noexcept;
+    UniquePtr(pointer ptr, D&& d) noexcept;
+
+    /// No Derived* for a Base[]: delete[] and operator[] would use the
+    /// wrong element size. Pointers that only add const stay accepted.
+    template <typename U, typename = std::enable_if_t<!std::is_convertible_v<U (*)[], T (*)[]>>>
+    explicit UniquePtr(U* ptr) = delete;
+    template <typename U, typename = std::enable_if_t<!std::is_convertible_v<U (*)[], T (*)[]>>>
+    UniquePtr(U* ptr, const D& d) = delete;
+    template <typename U, typename = std::enable_if_t<!std::is_convertible_v<U (*)[], T (*)[]>>>
+    UniquePtr(U* ptr, D&& d) = delete;
+
+    UniquePtr(const UniquePtr& other) = delete;
+    UniquePtr(UniquePtr&& other) noexcept;
+
+    UniquePtr& operator=(const UniquePtr& other) = delete;
+    UniquePtr& operator=(UniquePtr&& other) noexcept;
+    UniquePtr& operator=(std::nullptr_t) noexcept;
+
+    ~UniquePtr();
+
+    explicit operator bool() const noexcept;
+
+    T& operator[](std::size_t i) const;
+
+    // raw access
+    pointer get() const noexcept;
+    pointer release() noexcept;
+    void    reset(pointer ptr = pointer()) noexcept;
+    void    reset(std::nullptr_t) noexcept;
+    template <typename U, typename = std::enable_if_t<!std::is_convertible_v<U (*)[], T (*)[]>>>
+    void    reset(U* ptr) = delete;
+    void    swap(UniquePtr& other) noexcept;
+
+    D& get_deleter() noexcept;
+    const D& get_deleter() const noexcept;
+
+private:
+    unique_ptr_detail::Storage<pointer, D> s_;
+};
+
+/// new T(args...) owned by a UniquePtr
+template <typename T, typename... Args, typename = std::enable_if_t<!std::is_array_v<T>>>
+UniquePtr<T> make_unique(Args&&... args);
+
+/// new T[n]() owned by a UniquePtr<T[]>
+template <typename T, typename = std::enable_if_t<std::is_array_v<T>>>
+UniquePtr<T> make_unique(std::size_t n);
+
+//–– UniquePtr<T, D> ––//
+
+template <typename T, typename D>
+UniquePtr<T, D>::UniquePtr() noexcept
+    : s_()
+{}
+
+template <typename T, typename D>
+UniquePtr<T, D>::UniquePtr(std::nullptr_t) noexcept
+    : s_()
+{}
+
+template <typename T, typename D>
+UniquePtr<T, D>::UniquePtr(pointer ptr) noexcept
+    : s_(ptr, D())
+{}
+
+template <typename T, typename D>
+UniquePtr<T, D>::UniquePtr(pointer ptr, const D& d) noexcept
+    : s_(ptr, d)
+{}
+
+template <typename T, typename D>
+UniquePtr<T, D>::UniquePtr(pointer ptr, D&& d) noexcept
+    : s_(ptr, std::move(d))
+{}
+
+template <typename T, typename D>
+UniquePtr<T, D>::UniquePtr(UniquePtr&& other) noexcept
+    : s_(other.release(), std::move(other.get_deleter()))
+{}
+
+template <typename T, typename D>
+template <typename U, typename E, typename>
+UniquePtr<T, D>::UniquePtr(UniquePtr<U, E>&& other) noexcept
+    : s_(other.release(), std::move(other.get_deleter()))
+{}
+
+template <typename T, typename D>
+UniquePtr<T, D>& UniquePtr<T, D>::operator=(UniquePtr&& other) noexcept {
+    if (this != &other) {
+        reset(other.release());
+        get_deleter() = std::move(other.get_deleter());
+    }
+    return *this;
+}
+
+template <typename T, typename D>
+UniquePtr<T, D>& UniquePtr<T, D>::operator=(std::nullptr_t) noexcept {
+    reset();
+    return *this;
+}
+
+template <typename T, typename D>
+UniquePtr<T, D>::~UniquePtr() {
+    if (s_.ptr() != pointer()) get_deleter()(s_.ptr());
+}
+
+template <typename T, typename D>
+UniquePtr<T, D>::operator bool() const noexcept {
+    return s_.ptr() != pointer();
+}
+
+template <typename T, typename D>
+std::add_lvalue_reference_t<T> UniquePtr<T, D>::operator*() const {
+    return *s_.ptr();
+}
+
+template <typename T, typename D>
+typename UniquePtr<T, D>::pointer UniquePtr<T, D>::operator->() const noexcept {
+    return s_.ptr();
+}
+
+template <typename T, typename D>
+typename UniquePtr<T, D>::pointer UniquePtr<T, D>::get() const noexcept {
+    return s_.ptr();
+}
+
+template <typename T, typename D>
+typename UniquePtr<T, D>::pointer UniquePtr<T, D>::release() noexcept {
+    return std::exchange(s_.ptr(), pointer());
+}
+
+template <typename T, typename D>
+void UniquePtr<T, D>::reset(pointer ptr) noexcept {
+    pointer old = std::exchange(s_.ptr(), ptr);
+    if (old != pointer()) get_deleter()(old);
+}
+
+template <typename T, typename D>
+void UniquePtr<T, D>::swap(UniquePtr& other) noexcept {
+    using std::swap;
+    swap(s_, other.s_);
+}
+
+template <typename T, typename D>
+D& UniquePtr<T, D>::get_deleter() noexcept {
+    return s_.deleter();
+}
+
+template <typename T, typename D>
+const D& UniquePtr<T, D>::get_deleter() const noexcept {
+    return s_.deleter();
+}
+
+//–– UniquePtr<T[], D> ––//
+
+template <typename T, typename D>
+UniquePtr<T[], D>::UniquePtr() noexcept
+    : s_()
+{}
+
+template <typename T, typename D>
+UniquePtr<T[], D>::UniquePtr(std::nullptr_t) noexcept
+    : s_()
+{}
+
+template <typename T, typename D>
+UniquePtr<T[], D>::UniquePtr(pointer ptr) noexcept
+    : s_(ptr, D())
+{}
+
+template <typename T, typename D>
+UniquePtr<T[], D>::UniquePtr(pointer ptr, const D& d) noexcept
+    : s_(ptr, d)
+{}
+
+template <typename T, typename D>
+UniquePtr<T[], D>::UniquePtr(pointer ptr, D&& d) noexcept
+    : s_(ptr, std::move(d))
+{}
+
+template <typename T, typename D>
+UniquePtr<T[], D>::UniquePtr(UniquePtr&& other) noexcept
+    : s_(other.release(), std::move(other.get_deleter()))
+{}
+
+template <typename T, typename D>
+UniquePtr<T[], D>& UniquePtr<T[], D>::operator=(UniquePtr&& other) noexcept {
+    if (this != &other) {
+        reset(other.release());
+        get_deleter() = std::move(other.get_deleter());
+    }
+    return *this;
+}
+
+template <typename T, typename D>
+UniquePtr<T[], D>& UniquePtr<T[], D>::operator=(std::nullptr_t) noexcept {
+    reset();
+    return *this;
+}
+
+template <typename T, typename D>
+UniquePtr<T[], D>::~UniquePtr() {
+    if (s_.ptr() != pointer()) get_deleter()(s_.ptr());
+}
+
+template <typename T, typename D>
+UniquePtr<T[], D>::operator bool() const noexcept {
+    return s_.ptr() != pointer();
+}
+
+template <typename T, typename D>
+T& UniquePtr<T[], D>::operator[](std::size_t i) const {
+    return s_.ptr()[i];
+}
+
+template <typename T, typename D>
+typename UniquePtr<T[], D>::pointer UniquePtr<T[], D>::get() const noexcept {
+    return s_.ptr();
+}
+
+template <typename T, typename D>
+typename UniquePtr<T[], D>::pointer UniquePtr<T[], D>::release() noexcept {
+    return std::exchange(s_.ptr(), pointer());
+}
+
+template <typename T, typename D>
+void UniquePtr<T[], D>::reset(pointer ptr) noexcept {
+    pointer old = std::exchange(s_.ptr(), ptr);
+    if (old != pointer()) get_deleter()(old);
+}
+
+template <typename T, typename D>
+void UniquePtr<T[], D>::reset(std::nullptr_t) noexcept {
+    reset();
+}
+
+template <typename T, typename D>
+void UniquePtr<T[], D>::swap(UniquePtr& other) noexcept {
+    using std::swap;
+    swap(s_, other.s_);
+}
+
+template <typename T, typename D>
+D& UniquePtr<T[], D>::get_deleter() noexcept {
+    return s_.deleter();
+}
+
+template <typename T, typename D>
+const D& UniquePtr<T[], D>::get_deleter() const noexcept {
+    return s_.deleter();
+}
+
+//–– factories ––//
+
+template <typename T, typename... Args, typename>
+UniquePtr<T> make_unique(Args&&... args) {
+    return UniquePtr<T>(new T(std::forward<Args>(args)...));
+}
+
+template <typename T, typename>
+UniquePtr<T> make_unique(std::size_t n) {
+    return UniquePtr<T>(new std::remove_extent_t<T>[n]());
+}
+
 #endif // UNIQUEPTR_HPP
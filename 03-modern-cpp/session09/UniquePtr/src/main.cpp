@@ -1,17 +1,77 @@
 #include "UniquePtr.hpp"
 #include <cassert>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
+#include <fcntl.h>
+#include <unistd.h>
+
+// A stateless deleter must cost nothing: same size as the raw pointer
+static_assert(sizeof(UniquePtr<int>) == sizeof(int*));
+static_assert(sizeof(UniquePtr<int[]>) == sizeof(int*));
+static_assert(sizeof(UniquePtr<char, FreeDelete>) == sizeof(char*));
+inline auto close_file = [](std::FILE* f) { std::fclose(f); };
+static_assert(sizeof(UniquePtr<std::FILE, decltype(close_file)>) == sizeof(std::FILE*));
+// ...while a stateful one is stored next to it
+static_assert(sizeof(UniquePtr<int, void (*)(int*)>) == 2 * sizeof(int*));
+static_assert(!std::is_copy_constructible_v<UniquePtr<int>>);
+static_assert(std::is_nothrow_move_constructible_v<UniquePtr<int>>);
+
+// Owns a POSIX file descriptor; -1 plays the role of nullptr
+struct FdCloser {
+    struct pointer {
+        int fd = -1;
+        pointer() = default;
+        pointer(std::nullptr_t) {}
+        explicit pointer(int f) : fd(f) {}
+        friend bool operator==(pointer a, pointer b) { return a.fd == b.fd; }
+        friend bool operator!=(pointer a, pointer b) { return a.fd != b.fd; }
+    };
+    static inline int closed = 0;
+    void operator()(pointer p) const { ::close(p.fd); ++closed; }
+};
+
+struct Base {
+    virtual ~Base() = default;
+    virtual int id() const { return 1; }
+};
+struct Derived : Base {
+    static inline int destroyed = 0;
+    ~Derived() override { ++destroyed; }
+    int id() const override { return 2; }
+};
+
+// A Base[] cannot own a Derived array: delete[] and operator[] would step
+// by sizeof(Base). Adding const is fine.
+template <typename P, typename U, typename = void>
+struct can_reset : std::false_type {};
+template <typename P, typename U>
+struct can_reset<P, U, std::void_t<decltype(std::declval<P&>().reset(std::declval<U>()))>>
+    : std::true_type {};
+static_assert(std::is_constructible_v<UniquePtr<Base[]>, Base*>);
+static_assert(!std::is_constructible_v<UniquePtr<Base[]>, Derived*>);
+static_assert(!std::is_constructible_v<UniquePtr<Base[]>, Derived*, DefaultDelete<Base[]>>);
+static_assert(std::is_constructible_v<UniquePtr<const int[]>, int*>);
+static_assert(std::is_constructible_v<UniquePtr<Base[]>, std::nullptr_t>);
+static_assert(can_reset<UniquePtr<Base[]>, Base*>::value);
+static_assert(!can_reset<UniquePtr<Base[]>, Derived*>::value);
+static_assert(can_reset<UniquePtr<const int[]>, int*>::value);
+static_assert(can_reset<UniquePtr<Base[]>, std::nullptr_t>::value);
+
+static int g_freed = 0;
+static void counting_free(int* p) { ++g_freed; std::free(p); }
 
 int main() {
-    UniquePtr p1;
+    UniquePtr<int> p1;
     assert(!p1);
     std::cout << "p1 is null\n";
 
-    UniquePtr p2(new int(42));
+    UniquePtr<int> p2(new int(42));
     assert(p2 && *p2 == 42);
     std::cout << "p2 = " << *p2 << "\n";
 
-    UniquePtr p3(std::move(p2));
+    UniquePtr<int> p3(std::move(p2));
     assert(!p2 && p3 && *p3 == 42);
     std::cout << "after move, p2 is " << (p2 ? "not-null" : "null")
               << ", p3 = " << *p3 << "\n";
@@ -25,6 +85,51 @@ int main() {
     std::cout << "after release, raw = " << *raw << "\n";
     delete raw;
 
+    // arrays are released with delete[]
+    UniquePtr<int[]> arr = make_unique<int[]>(4);
+    for (int i = 0; i < 4; ++i) assert(arr[i] == 0);
+    arr[2] = 7;
+    assert(arr[2] == 7);
+    arr.reset(new int[2]{1, 2});
+    assert(arr[1] == 2);
+    arr.reset(nullptr);
+    assert(!arr);
+    UniquePtr<const int[]> carr(new int[3]{4, 5, 6});
+    assert(carr[2] == 6);
+    std::cout << "array ok\n";
+
+    // malloc'd buffers
+    UniquePtr<char, FreeDelete> buf(static_cast<char*>(std::malloc(16)));
+    std::strcpy(buf.get(), "malloc'd");
+    assert(std::strcmp(buf.get(), "malloc'd") == 0);
+    std::cout << "buffer = " << buf.get() << "\n";
+
+    // stateful deleter travels with the pointer on move
+    {
+        UniquePtr<int, void (*)(int*)> m(static_cast<int*>(std::malloc(sizeof(int))), counting_free);
+        UniquePtr<int, void (*)(int*)> n(std::move(m));
+        assert(!m && n && n.get_deleter() == counting_free);
+    }
+    assert(g_freed == 1);
+
+    // non-pointer handles through D::pointer
+    {
+        UniquePtr<int, FdCloser> fd(FdCloser::pointer(::open("/dev/null", O_RDONLY)));
+        assert(fd && fd.get().fd >= 0);
+        UniquePtr<int, FdCloser> none;
+        assert(!none);
+    }
+    assert(FdCloser::closed == 1);
+    std::cout << "fd closed\n";
+
+    // derived to base
+    {
+        UniquePtr<Base> b = make_unique<Derived>();
+        assert(b->id() == 2);
+        b = nullptr;
+        assert(!b && Derived::destroyed == 1);
+    }
+
     std::cout << "All tests passed\n";
     return 0;
 }
@@ -0,0 +1,86 @@
+#ifndef PARALLEL_CHUNKS_HPP
+#define PARALLEL_CHUNKS_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+// Execution policies and the thread fan-out shared by the bulk kernels of
+// this session: bulk:: in DynamicArray/include/BulkOps.hpp and batch:: in
+// Fraction/include/FractionBatch.hpp. Each of those re-exports the
+// policies under its own namespace with its own default slice size.
+namespace parallel {
+
+struct SequentialPolicy {};
+
+// MinChunk: default for min_chunk, the smallest slice worth a thread
+template <std::size_t MinChunk>
+struct BasicParallelPolicy {
+    unsigned threads = 0;               // 0 = std::thread::hardware_concurrency()
+    std::size_t min_chunk = MinChunk;
+};
+
+template <std::size_t MinChunk>
+std::size_t max_threads(const BasicParallelPolicy<MinChunk>& pol) noexcept {
+    unsigned hw = pol.threads ? pol.threads : std::thread::hardware_concurrency();
+    return hw ? hw : 1;
+}
+
+namespace detail {
+
+// Joins every worker started so far, also when starting the next one or
+// running the caller's own slice throws
+struct Joiner {
+    std::vector<std::thread>& workers;
+    ~Joiner() {
+        for (auto& w : workers)
+            if (w.joinable()) w.join();
+    }
+};
+
+} // namespace detail
+
+// Runs f(begin, end, chunk) over at most max_threads(pol) contiguous slices
+// of [0, n) and returns the number of slices used. If slices throw, the
+// first one's exception is rethrown once all of them have finished.
+template <std::size_t MinChunk, typename F>
+std::size_t for_each_chunk(const BasicParallelPolicy<MinChunk>& pol, std::size_t n, F f) {
+    std::size_t max_chunks = pol.min_chunk ? n / pol.min_chunk : n;
+    std::size_t chunks = std::max<std::size_t>(1, std::min(max_threads(pol), max_chunks));
+
+    if (chunks == 1) {
+        f(std::size_t(0), n, std::size_t(0));
+        return 1;
+    }
+
+    std::vector<std::exception_ptr> errors(chunks);
+    auto guarded = [&](std::size_t b, std::size_t e, std::size_t c) {
+        try {
+            f(b, e, c);
+        } catch (...) {
+            errors[c] = std::current_exception();
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(chunks - 1);
+    std::size_t step = n / chunks;
+    {
+        detail::Joiner joiner{workers};
+        for (std::size_t c = 1; c < chunks; ++c) {
+            std::size_t b = c * step;
+            std::size_t e = c + 1 == chunks ? n : b + step;
+            workers.emplace_back(guarded, b, e, c);
+        }
+        guarded(std::size_t(0), step, std::size_t(0));
+    }
+    for (auto& err : errors)
+        if (err) std::rethrow_exception(err);
+    return chunks;
+}
+
+} // namespace parallel
+
+#endif // PARALLEL_CHUNKS_HPP